@@ -66,6 +66,6 @@ private:
     bool verbose;
 };
 
-extern CodeHelper hlp;
+extern thread_local CodeHelper hlp;
 
 #endif
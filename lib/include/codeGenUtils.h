@@ -2,10 +2,15 @@
 
 // Standard includes
 #include <limits>
+#include <set>
 #include <string>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
+// GeNN includes
+#include "newModels.h"
+
 using namespace std;
 
 // Forward declarations
@@ -83,18 +88,26 @@ inline void name_substitutions(string &code, const string &prefix, const vector<
 //--------------------------------------------------------------------------
 //! \brief This function performs a list of value substitutions for parameters in code snippets.
 //--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+//! \brief This function formats a parameter value, with full precision and in brackets, for insertion into code snippets.
+//--------------------------------------------------------------------------
+inline string valueToString(double value)
+{
+    stringstream stream;
+    stream.precision(std::numeric_limits<double>::max_digits10);
+    stream << std::scientific << value;
+    return "(" + stream.str() + ")";
+}
+
 template<typename NameIter>
 inline void value_substitutions(string &code, NameIter namesBegin, NameIter namesEnd, const vector<double> &values, const string &ext = "")
 {
     NameIter n = namesBegin;
     auto v = values.cbegin();
     for (;n != namesEnd && v != values.cend(); n++, v++) {
-        stringstream stream;
-        stream.precision(std::numeric_limits<double>::max_digits10);
-        stream << std::scientific << *v;
         substitute(code,
                    "$(" + *n + ext + ")",
-                   "(" + stream.str() + ")");
+                   valueToString(*v));
     }
 }
 
@@ -103,6 +116,91 @@ inline void value_substitutions(string &code, const vector<string> &names, const
     value_substitutions(code, names.cbegin(), names.cend(), values, ext);
 }
 
+//--------------------------------------------------------------------------
+/*! \brief Set of bindings for $(name) tokens which are all substituted into a code snippet in a single pass.
+
+  Rather than searching the whole snippet once per name, as successive calls to substitute,
+  name_substitutions and value_substitutions do, apply scans the snippet once and looks up
+  every $(name) token in a hash map. As with successive substitutions, the first binding
+  added for a name takes precedence.
+ */
+//--------------------------------------------------------------------------
+class CodeSubstitutions
+{
+public:
+    //! Bind $(name) to replacement - ignored if name is already bound
+    void addVarSubstitution(const string &name, const string &replacement)
+    {
+        m_Bindings.emplace(name, replacement);
+    }
+
+    //! Bind $(<name><ext>) to <prefix><name><postfix> for every name, as name_substitutions does
+    template<typename NameIter>
+    void addNameSubstitutions(const string &prefix, NameIter namesBegin, NameIter namesEnd, const string &postfix= "", const string &ext = "")
+    {
+        for (NameIter n = namesBegin; n != namesEnd; n++) {
+            addVarSubstitution(*n + ext, prefix + *n + postfix);
+        }
+    }
+
+    void addNameSubstitutions(const string &prefix, const vector<string> &names, const string &postfix= "", const string &ext = "")
+    {
+        addNameSubstitutions(prefix, names.cbegin(), names.cend(), postfix, ext);
+    }
+
+    //! Bind $(<name><ext>) to the corresponding value, as value_substitutions does
+    template<typename NameIter>
+    void addValueSubstitutions(NameIter namesBegin, NameIter namesEnd, const vector<double> &values, const string &ext = "")
+    {
+        NameIter n = namesBegin;
+        auto v = values.cbegin();
+        for (;n != namesEnd && v != values.cend(); n++, v++) {
+            addVarSubstitution(*n + ext, valueToString(*v));
+        }
+    }
+
+    void addValueSubstitutions(const vector<string> &names, const vector<double> &values, const string &ext = "")
+    {
+        addValueSubstitutions(names.cbegin(), names.cend(), values, ext);
+    }
+
+    //! Bind $(<name><ext>) to <structName>.<name> for the names kept as runtime values and to the corresponding value otherwise
+    template<typename NameIter>
+    void addParamSubstitutions(NameIter namesBegin, NameIter namesEnd, const vector<double> &values,
+                               const set<string> &runtimeParams, const string &structName, const string &ext = "")
+    {
+        NameIter n = namesBegin;
+        auto v = values.cbegin();
+        for (;n != namesEnd && v != values.cend(); n++, v++) {
+            if (runtimeParams.find(*n) != runtimeParams.end()) {
+                addVarSubstitution(*n + ext, structName + "." + *n);
+            }
+            else {
+                addVarSubstitution(*n + ext, valueToString(*v));
+            }
+        }
+    }
+
+    void addParamSubstitutions(const vector<string> &names, const vector<double> &values,
+                               const set<string> &runtimeParams, const string &structName, const string &ext = "")
+    {
+        addParamSubstitutions(names.cbegin(), names.cend(), values, runtimeParams, structName, ext);
+    }
+
+    //! Substitute every bound $(name) token in code - names of any unbound tokens are added to unresolved if it is not NULL
+    void apply(string &code, vector<string> *unresolved = NULL) const;
+
+    //! Substitute every bound $(name) token in code and raise a gennError if any unbound tokens remain (see checkUnreplacedVariables)
+    void applyChecked(string &code, const string &codeName) const;
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    unordered_map<string, string> m_Bindings;
+};
+
+
 //--------------------------------------------------------------------------
 /*! \brief This function implements a parser that converts any floating point constant in a code snippet to a floating point constant with an explicit precision (by appending "f" or removing it).
  */
@@ -111,6 +209,23 @@ inline void value_substitutions(string &code, const vector<string> &names, const
 string ensureFtype(const string &oldcode, const string &type);
 
 
+//--------------------------------------------------------------------------
+/*! \brief Function for adding the derived parameters whose values change with those of any of the runtime parameters to runtimeParams.
+
+  Derived parameters are calculated by functions which only exist in the code generator, so the generated code
+  cannot recalculate them - the dependent ones are kept as runtime values too and a warning is given.
+ */
+//--------------------------------------------------------------------------
+
+void addRuntimeDerivedParams(const string &groupName, //!< name of the group for the warning
+                             const vector<string> &paramNames,
+                             const vector<double> &params,
+                             const NewModels::Base::DerivedParamVec &derivedParams,
+                             const vector<double> &derivedParamValues,
+                             double dt,
+                             set<string> &runtimeParams);
+
+
 //--------------------------------------------------------------------------
 /*! \brief This function checks for unknown variable definitions and returns a gennError if any are found
  */
@@ -119,6 +234,30 @@ string ensureFtype(const string &oldcode, const string &type);
 void checkUnreplacedVariables(const string &code, const string &codeName);
 
 
+//--------------------------------------------------------------------------
+/*! \brief This function checks whether code may write to $(name) i.e. assigns to, increments, decrements or takes the address of it
+ */
+//--------------------------------------------------------------------------
+
+bool isVarAssigned(const string &code, const string &name);
+
+
+//--------------------------------------------------------------------------
+/*! \brief This function replaces DT in the code of a group which is only updated every updatePeriod time steps with the time the group advances by in each update
+ */
+//--------------------------------------------------------------------------
+
+void substituteUpdatePeriodDT(string &code, unsigned int updatePeriod);
+
+
+//--------------------------------------------------------------------------
+/*! \brief This function checks whether postsynaptic decay code only multiplies $(inSyn) by a factor which depends on nothing but the given parameters
+ */
+//--------------------------------------------------------------------------
+
+bool isExponentialDecayCode(const string &decayCode, const vector<string> &paramNames);
+
+
 //-------------------------------------------------------------------------
 /*!
   \brief Function for performing the code and value substitutions necessary to insert neuron related variables, parameters, and extraGlobal parameters into synaptic code.
@@ -130,4 +269,12 @@ void neuron_substitutions_in_synaptic_code(
     const SynapseGroup *sg,
     const string &preIdx, //!< index of the pre-synaptic neuron to be accessed for _pre variables; differs for different Span)
     const string &postIdx, //!< index of the post-synaptic neuron to be accessed for _post variables; differs for different Span)
+    const string &devPrefix); //!< device prefix, "dd_" for GPU, nothing for CPU
+
+//! Add the bindings used by neuron_substitutions_in_synaptic_code to a set of substitutions
+void neuron_substitutions_in_synaptic_code(
+    CodeSubstitutions &substitutions, //!< the substitutions to add to
+    const SynapseGroup *sg,
+    const string &preIdx, //!< index of the pre-synaptic neuron to be accessed for _pre variables; differs for different Span)
+    const string &postIdx, //!< index of the post-synaptic neuron to be accessed for _post variables; differs for different Span)
     const string &devPrefix); //!< device prefix, "dd_" for GPU, nothing for CPU
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+//----------------------------------------------------------------------------
+// NeuronGroupCounters
+//----------------------------------------------------------------------------
+//! Events counted for a neuron group when NNmodel::setEventCounting(true) has been called
+struct NeuronGroupCounters
+{
+    NeuronGroupCounters() : spikes(0), spikeEvents(0) {}
+
+    void reset(){ spikes = 0; spikeEvents = 0; }
+
+    unsigned long long spikes;          //!< Number of true spikes emitted
+    unsigned long long spikeEvents;     //!< Number of spike-like events emitted
+};
+
+//----------------------------------------------------------------------------
+// SynapseGroupCounters
+//----------------------------------------------------------------------------
+//! Events counted for a synapse group when NNmodel::setEventCounting(true) has been called
+struct SynapseGroupCounters
+{
+    SynapseGroupCounters() : preSpikes(0), preSpikeEvents(0), synapseUpdates(0), postLearnUpdates(0), synDynUpdates(0) {}
+
+    void reset(){ preSpikes = 0; preSpikeEvents = 0; synapseUpdates = 0; postLearnUpdates = 0; synDynUpdates = 0; }
+
+    unsigned long long preSpikes;           //!< Number of presynaptic spikes processed
+    unsigned long long preSpikeEvents;      //!< Number of presynaptic spike-like events processed
+    unsigned long long synapseUpdates;      //!< Number of times the sim or event code was executed for a synapse
+    unsigned long long postLearnUpdates;    //!< Number of times the post-learning code was executed for a synapse
+    unsigned long long synDynUpdates;       //!< Number of times the synapse dynamics code was executed for a synapse
+};
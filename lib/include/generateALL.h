@@ -23,11 +23,66 @@
 
 #include "modelSpec.h"
 
+#include <fstream>
+#include <functional>
 #include <string>
+#include <vector>
 
 using namespace std;
 
 
+//--------------------------------------------------------------------------
+/*! \brief Open a stream for writing a generated code file.
+
+  Output is written to a temporary file which closeGeneratedFile only moves into place if it differs from the existing file.
+ */
+//--------------------------------------------------------------------------
+
+void openGeneratedFile(ofstream &os,        //!< Stream to open
+                       const string &name   //!< Path of generated file
+                       );
+
+
+//--------------------------------------------------------------------------
+/*! \brief Close a stream opened with openGeneratedFile.
+
+  If the existing file has identical contents, it is left untouched so that its timestamp does not trigger a rebuild. The contents are also added to the generated code hash.
+ */
+//--------------------------------------------------------------------------
+
+void closeGeneratedFile(ofstream &os,       //!< Stream to close
+                        const string &name  //!< Path of generated file
+                        );
+
+
+//--------------------------------------------------------------------------
+/*! \brief Add a string which affects the build, but not the generated code (e.g. compiler flags), to the generated code hash.
+ */
+//--------------------------------------------------------------------------
+
+void hashGeneratedCode(const string &data);
+
+
+//--------------------------------------------------------------------------
+/*! \brief Get the hash of all code generated by the current generate_model_runner call as a hexadecimal string.
+
+  As the generated code is entirely determined by the finalised model and the generator, this identifies a build of the model and is used to key the cache of compiled objects.
+ */
+//--------------------------------------------------------------------------
+
+string getGeneratedCodeHash();
+
+
+//--------------------------------------------------------------------------
+/*! \brief Run independent code generation tasks, each of which typically generates one file, and wait for all of them to complete.
+
+  Tasks are run on GENN_PREFERENCES::codeGenerationThreads threads and may themselves call runGenerationTasks. Each task starts with the brace level of the calling thread, so they must not share any other state unless it is protected (openGeneratedFile and closeGeneratedFile are safe to call from tasks).
+ */
+//--------------------------------------------------------------------------
+
+void runGenerationTasks(const vector<function<void()>> &tasks);
+
+
 //--------------------------------------------------------------------------
 /*! \brief This function will call the necessary sub-functions to generate the code for simulating a model.
  */
@@ -61,6 +61,43 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
 #endif // CPU_ONLY
 
 
+//----------------------------------------------------------------------------
+/*!
+  \brief A function that generates init.cc containing the code which initialises the model variables and sparse connectivity.
+
+  In the CPU_ONLY version init.cc is compiled as its own translation unit, otherwise it is included in runner.cc as it copies data to device symbols.
+*/
+//----------------------------------------------------------------------------
+
+void genInit(const NNmodel &model, //!< Model description
+             const string &path    //!< Path for code generation
+             );
+
+
+//----------------------------------------------------------------------------
+/*!
+  \brief A function that generates sharedLibrary.cc containing the C interface exported when the model is built as a shared library.
+
+  Only generated if GENN_PREFERENCES::buildSharedLibrary is set. All other generated code is compiled with hidden visibility so the genn_ prefixed functions defined here are the only symbols exported by the library (see SharedLibraryModel).
+*/
+//----------------------------------------------------------------------------
+
+void genSharedLibrary(const NNmodel &model, //!< Model description
+                      const string &path    //!< Path for code generation
+                      );
+
+
+//----------------------------------------------------------------------------
+/*!
+  \brief A function that writes the per-group choices made from the model's profile (see NNmodel::setProfile) to profileReport.txt.
+*/
+//----------------------------------------------------------------------------
+
+void genProfileReport(const NNmodel &model, //!< Model description
+                      const string &path    //!< Path for code generation
+                      );
+
+
 //----------------------------------------------------------------------------
 /*!
   \brief A function that generates the Makefile for all generated GeNN code.
@@ -47,6 +47,11 @@ namespace GENN_PREFERENCES {
     extern unsigned int learningBlockSize;
     extern unsigned int synapseDynamicsBlockSize;
     extern unsigned int autoRefractory; //!< Flag for signalling whether spikes are only reported if thresholdCondition changes from false to true (autoRefractory == 1) or spikes are emitted whenever thresholdCondition is true no matter what.%
+    extern bool promoteConstantVars; //!< Request that state variables which no code snippet writes to are substituted as constants with their initial values rather than stored in arrays
+    extern bool mergeIdenticalGroups; //!< Request that the CPU updates of neuron groups which only differ in parameter values and size share one generated loop
+    extern bool buildSharedLibrary; //!< Request that the generated code is additionally linked into a position-independent shared library (lib<model>.so) exporting the C interface used by SharedLibraryModel (UNIX only)
+    extern double profileHotGroupShare; //!< Share of the profiled neuron update time from which a neuron group keeps its own specialised CPU update rather than being merged (see NNmodel::setProfile)
+    extern unsigned int codeGenerationThreads; //!< Number of threads used to generate code - 0 uses one per hardware thread
     extern std::string userCxxFlagsWIN; //!< Allows users to set specific C++ compiler options they may want to use for all host side code (used for windows platforms)
     extern std::string userCxxFlagsGNU; //!< Allows users to set specific C++ compiler options they may want to use for all host side code (used for unix based platforms)
     extern std::string userNvccFlags; //!< Allows users to set specific nvcc compiler options they may want to use for all GPU code (identical for windows and unix platforms)
@@ -0,0 +1,75 @@
+#pragma once
+
+// Standard includes
+#include <chrono>
+#include <cstdio>
+
+//----------------------------------------------------------------------------
+// GroupTimingStats
+//----------------------------------------------------------------------------
+//! Accumulated wall-clock time spent in one phase of one population's update
+/*! Used by generated code when NNmodel::setGroupTiming(true) has been called.
+    Timing is done with std::chrono::steady_clock, which is read from user space
+    (vDSO / rdtsc) on common platforms rather than through a system call. */
+struct GroupTimingStats
+{
+    //! Number of histogram buckets - bucket b counts samples of [2^b, 2^(b+1)) ns
+    static const unsigned int numBuckets = 32;
+
+    GroupTimingStats(const char *n, const char *p) : name(n), phase(p)
+    {
+        reset();
+    }
+
+    //! Reset all accumulated statistics
+    void reset()
+    {
+        count = 0;
+        totalSeconds = 0.0;
+        for(unsigned int b = 0; b < numBuckets; b++) {
+            histogram[b] = 0;
+        }
+    }
+
+    //! Add one sample
+    void add(std::chrono::steady_clock::duration duration)
+    {
+        unsigned long long ns = (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        totalSeconds += (double)ns * 1.0E-9;
+        count++;
+
+        unsigned int b = 0;
+        while((ns >>= 1) != 0 && b < (numBuckets - 1)) {
+            b++;
+        }
+        histogram[b]++;
+    }
+
+    //! Mean time per update in seconds
+    double getMean() const{ return (count == 0) ? 0.0 : (totalSeconds / (double)count); }
+
+    const char *name;   //!< Name of neuron or synapse group
+    const char *phase;  //!< Phase of the time step ("neuron", "synapse", "learning" or "synapseDynamics")
+    unsigned long long count;
+    double totalSeconds;
+    unsigned long long histogram[numBuckets];
+};
+
+//----------------------------------------------------------------------------
+// Functions
+//----------------------------------------------------------------------------
+//! Write a table of timing statistics to an open file as a JSON array
+inline void writeGroupTimingJSON(FILE *f, GroupTimingStats *const *stats, unsigned int numStats)
+{
+    fprintf(f, "[\n");
+    for(unsigned int i = 0; i < numStats; i++) {
+        const GroupTimingStats *s = stats[i];
+        fprintf(f, "  {\"group\": \"%s\", \"phase\": \"%s\", \"count\": %llu, \"total\": %.9e, \"mean\": %.9e, \"histogram\": [",
+                s->name, s->phase, s->count, s->totalSeconds, s->getMean());
+        for(unsigned int b = 0; b < GroupTimingStats::numBuckets; b++) {
+            fprintf(f, (b == 0) ? "%llu" : ", %llu", s->histogram[b]);
+        }
+        fprintf(f, (i == (numStats - 1)) ? "]}\n" : "]},\n");
+    }
+    fprintf(f, "]\n");
+}
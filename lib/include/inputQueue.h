@@ -0,0 +1,139 @@
+#pragma once
+
+// Standard includes
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+//----------------------------------------------------------------------------
+// InputQueue
+//----------------------------------------------------------------------------
+//! Single-producer, single-consumer lock-free ring of timestamped input frames
+/*! One of these is generated for every neuron group with an input queue enabled
+    (see NeuronGroup::setInputQueueCapacity). A single producer thread (e.g. a
+    sensor reader) pushes frames while the simulation thread consumes them at the
+    start of the time step they are stamped with. All frame storage is allocated
+    up front so neither side allocates memory or takes a lock once running. */
+template<typename T>
+class InputQueue
+{
+public:
+    //! Type of payload carried by a frame
+    enum class FrameType
+    {
+        VALUES, //!< One value per neuron, written into the state variable selected by target
+        SPIKES  //!< List of neuron indices which are emitted as spikes
+    };
+
+    struct Frame
+    {
+        unsigned long long timestep;        //!< Time step (iT) at which frame should be applied
+        FrameType type;                     //!< Type of payload
+        unsigned int target;                //!< Index of target state variable (VALUES frames only)
+        unsigned int count;                 //!< Number of valid entries in spikes (SPIKES frames only)
+        std::vector<T> values;              //!< One value per neuron
+        std::vector<unsigned int> spikes;   //!< Indices of spiking neurons
+    };
+
+    InputQueue(unsigned int capacity, unsigned int numNeurons)
+    : m_Frames(capacity), m_NumNeurons(numNeurons), m_Head(0), m_Tail(0)
+    {
+        for(auto &f : m_Frames) {
+            f.values.resize(numNeurons);
+            f.spikes.resize(numNeurons);
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // Producer-side methods
+    //------------------------------------------------------------------------
+    //! Get next free frame to fill or NULL if queue is full - frame is only made visible to consumer by commitPush
+    Frame *beginPush()
+    {
+        const size_t head = m_Head.load(std::memory_order_relaxed);
+        if((head - m_Tail.load(std::memory_order_acquire)) == m_Frames.size()) {
+            return NULL;
+        }
+        else {
+            return &m_Frames[head % m_Frames.size()];
+        }
+    }
+
+    //! Publish frame previously obtained with beginPush to the consumer
+    void commitPush()
+    {
+        m_Head.store(m_Head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    //! Copy one value per neuron into a frame targetting state variable target - returns false if queue is full
+    bool pushValues(unsigned long long timestep, unsigned int target, const T *values)
+    {
+        Frame *f = beginPush();
+        if(f == NULL) {
+            return false;
+        }
+
+        f->timestep = timestep;
+        f->type = FrameType::VALUES;
+        f->target = target;
+        f->count = 0;
+        std::copy(values, values + m_NumNeurons, f->values.begin());
+        commitPush();
+        return true;
+    }
+
+    //! Copy a list of neuron indices into a spike frame - returns false if queue is full
+    bool pushSpikes(unsigned long long timestep, const unsigned int *spikes, unsigned int count)
+    {
+        Frame *f = beginPush();
+        if(f == NULL) {
+            return false;
+        }
+
+        f->timestep = timestep;
+        f->type = FrameType::SPIKES;
+        f->target = 0;
+        f->count = std::min(count, m_NumNeurons);
+        std::copy(spikes, spikes + f->count, f->spikes.begin());
+        commitPush();
+        return true;
+    }
+
+    //------------------------------------------------------------------------
+    // Consumer-side methods
+    //------------------------------------------------------------------------
+    //! Get oldest frame in queue or NULL if queue is empty
+    const Frame *front() const
+    {
+        const size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if(tail == m_Head.load(std::memory_order_acquire)) {
+            return NULL;
+        }
+        else {
+            return &m_Frames[tail % m_Frames.size()];
+        }
+    }
+
+    //! Return oldest frame in queue to producer
+    void pop()
+    {
+        m_Tail.store(m_Tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    //------------------------------------------------------------------------
+    // Public const methods
+    //------------------------------------------------------------------------
+    unsigned int getCapacity() const{ return (unsigned int)m_Frames.size(); }
+    unsigned int getNumNeurons() const{ return m_NumNeurons; }
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    std::vector<Frame> m_Frames;
+    const unsigned int m_NumNeurons;
+
+    //!< Monotonically increasing write and read counters - producer only writes head, consumer only writes tail
+    std::atomic<size_t> m_Head;
+    std::atomic<size_t> m_Tail;
+};
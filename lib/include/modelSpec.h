@@ -97,6 +97,11 @@ public:
     void setPrecision(FloatType); //!< Set numerical precision for floating point
     void setDT(double); //!< Set the integration step size of the model
     void setTiming(bool); //!< Set whether timers and timing commands are to be included
+    void setGroupTiming(bool); //!< Set whether the update of each individual group is to be timed (CPU only)
+    void setEventCounting(bool); //!< Set whether spikes, synaptic events and learning updates are to be counted per group (CPU only)
+    void setRealTimePacing(bool); //!< Set whether the runner includes a driver which paces time steps to wall-clock time (CPU only)
+    void setProfile(const std::string &filename); //!< Set the profile written by dumpProfile() in a profiling build of this model, from which finalize() chooses per-group update strategies
+    void setBatchSize(unsigned int); //!< Set the number of independent instances of the model which are simulated together (CPU only)
     void setSeed(unsigned int); //!< Set the random seed (disables automatic seeding if argument not 0).
     void setRNType(const std::string &type); //! Sets the underlying type for random number generation (default: uint64_t)
 #ifndef CPU_ONLY
@@ -111,6 +116,12 @@ public:
     //! Are any variables in any populations in this model using zero-copy memory?
     bool zeroCopyInUse() const;
 
+    //! Do any neuron groups in this model have an input queue?
+    bool inputQueueInUse() const;
+
+    //! Do any neuron groups in this model record their spikes during multi-step stepping?
+    bool spikeRecordingInUse() const;
+
     //! Gets the name of the neuronal network model
     const std::string &getName() const{ return name; }
 
@@ -135,6 +146,24 @@ public:
     //! Are timers and timing commands enabled
     bool isTimingEnabled() const{ return timing; }
 
+    //! Is per-group timing of the CPU updates enabled
+    bool isGroupTimingEnabled() const{ return groupTiming; }
+
+    //! Is per-group counting of spikes, synaptic events and learning updates enabled
+    bool isEventCountingEnabled() const{ return eventCounting; }
+
+    //! Is the real-time paced driver of the CPU time steps enabled
+    bool isRealTimePacingEnabled() const{ return realTimePacing; }
+
+    //! Gets the number of independent instances of the model which are simulated together
+    unsigned int getBatchSize() const{ return batchSize; }
+
+    //! Gets the profile from which per-group update strategies are chosen or an empty string if there is none
+    const std::string &getProfile() const{ return profile; }
+
+    //! Gets the per-group choices made from the profile, one line per group
+    const vector<string> &getProfileReport() const{ return m_ProfileReport; }
+
     // PUBLIC NEURON FUNCTIONS
     //========================
     //! Get std::map containing all named NeuronGroup objects in model
@@ -195,6 +224,10 @@ public:
         }
     }
 
+    //! Gets the sets of neuron groups whose CPU updates share one generated loop
+    /*! Each set contains at least two groups and code is generated from its first group (see GENN_PREFERENCES::mergeIdenticalGroups) */
+    const vector<vector<string>> &getMergedNeuronGroups() const{ return m_MergedNeuronGroups; }
+
     void setNeuronClusterIndex(const string &neuronGroup, int hostID, int deviceID); //!< Function for setting which host and which device a neuron group will be simulated on
 
     void activateDirectInput(const string&, unsigned int type); //! This function has been deprecated in GeNN 2.2
@@ -354,6 +387,12 @@ private:
     //!< **THINK** is this the right container?
     map<string, std::pair<unsigned int, unsigned int>> m_SynapseDynamicsGroups;
 
+    //!< Names of the neuron groups in each set of groups whose CPU updates are merged
+    vector<vector<string>> m_MergedNeuronGroups;
+
+    //!< Per-group choices made from the profile
+    vector<string> m_ProfileReport;
+
     // Kernel members
     map<string, string> neuronKernelParameters;
     map<string, string> synapseKernelParameters;
@@ -369,6 +408,11 @@ private:
     bool needSt; //!< Whether last spike times are needed at all in this network model (related to STDP)
     bool needSynapseDelay; //!< Whether delayed synapse conductance is required in the network
     bool timing;
+    bool groupTiming; //!< Whether the update of each group is timed individually
+    bool eventCounting; //!< Whether spikes, synaptic events and learning updates are counted per group
+    bool realTimePacing; //!< Whether the runner includes a driver which paces time steps to wall-clock time
+    string profile; //!< Profile written by dumpProfile() from which per-group update strategies are chosen
+    unsigned int batchSize; //!< Number of independent instances of the model which share connectivity but have separate state
     unsigned int seed;
     unsigned int resetKernel;  //!< The identity of the kernel in which the spike counters will be reset.
 
@@ -22,7 +22,8 @@ public:
         m_SpikeTimeRequired(false), m_TrueSpikeRequired(false), m_SpikeEventRequired(false), m_QueueRequired(false),
         m_NumDelaySlots(1),
         m_SpikeZeroCopyEnabled(false), m_SpikeEventZeroCopyEnabled(false), m_SpikeTimeZeroCopyEnabled(false),
-        m_HostID(0), m_DeviceID(0)
+        m_InputQueueCapacity(0), m_SpikeRecordingEnabled(false), m_UpdatePeriod(1),
+        m_QuiescenceSkippingEnabled(false), m_HostID(0), m_DeviceID(0)
     {
     }
 
@@ -55,6 +56,26 @@ public:
      //!< May improve IO performance at the expense of kernel performance
     void setVarZeroCopyEnabled(const std::string &varName, bool enabled);
 
+    //!< Function to keep a parameter as a runtime value, which can be changed between time steps with a generated setter
+    //!< function, rather than substituting it into the generated code as a constant
+    void setParamRuntimeEnabled(const std::string &paramName, bool enabled);
+
+    //!< Function to enable a lock-free input queue of the given number of frames through which another thread
+    //!< can stream timestamped state variable values or spikes into this group while it is being simulated (0 disables)
+    void setInputQueueCapacity(unsigned int capacity){ m_InputQueueCapacity = capacity; }
+
+    //!< Function to enable recording of this group's spikes into buffers allocated with allocateSpikeRecording(numSteps),
+    //!< which stepTimeCPU(numSteps) and stepTimeGPU(numSteps) fill without returning to the caller between time steps
+    void setSpikeRecordingEnabled(bool enabled){ m_SpikeRecordingEnabled = enabled; }
+
+    //!< Function to only update this group on every numSteps'th time step, advancing it by numSteps * DT each time.
+    //!< Spikes still arriving on the steps in between accumulate in inSyn and are applied by the next update
+    void setUpdatePeriod(unsigned int numSteps);
+
+    //!< Function to skip the update of this group on the CPU while all of its neurons satisfy the rest condition of its neuron
+    //!< model and receive no input. Code on the host which changes the group's state must set quiescent<group name> to false
+    void setQuiescenceSkippingEnabled(bool enabled);
+
     void setClusterIndex(int hostID, int deviceID){ m_HostID = hostID; m_DeviceID = deviceID; }
 
     void addSpkEventCondition(const std::string &code, const std::string &supportCodeNamespace);
@@ -62,6 +83,16 @@ public:
     void addInSyn(SynapseGroup *synapseGroup){ m_InSyn.push_back(synapseGroup); }
     void addOutSyn(SynapseGroup *synapseGroup){ m_OutSyn.push_back(synapseGroup); }
 
+    //!< Marks which parameters and derived parameters differ between the neuron groups this group is merged with
+    void setHeterogeneousParams(const std::vector<bool> &params, const std::vector<bool> &derivedParams)
+    {
+        m_HeterogeneousParams = params;
+        m_HeterogeneousDerivedParams = derivedParams;
+    }
+
+    //!< Marks the state variables which are substituted as constants with their initial values rather than stored in arrays
+    void setConstantVars(const std::set<std::string> &vars){ m_ConstantVars = vars; }
+
     void initDerivedParams(double dt);
     void calcSizes(unsigned int blockSize, unsigned int &idStart, unsigned int &paddedIDStart);
 
@@ -101,12 +132,42 @@ public:
     bool isZeroCopyEnabled() const;
     bool isVarZeroCopyEnabled(const std::string &var) const;
 
+    bool isParamRuntimeEnabled(const std::string &param) const;
+    bool isRuntimeParamsRequired() const{ return !m_RuntimeParams.empty(); }
+    const std::set<std::string> &getRuntimeParams() const{ return m_RuntimeParams; }
+
+    unsigned int getInputQueueCapacity() const{ return m_InputQueueCapacity; }
+    bool isInputQueueEnabled() const{ return (m_InputQueueCapacity > 0); }
+
+    bool isSpikeRecordingEnabled() const{ return m_SpikeRecordingEnabled; }
+
+    unsigned int getUpdatePeriod() const{ return m_UpdatePeriod; }
+
+    bool isQuiescenceSkippingEnabled() const{ return m_QuiescenceSkippingEnabled; }
+
     bool isParamRequiredBySpikeEventCondition(const std::string &pnamefull) const;
 
+    //!< May any code snippet, input queue or zero-copied host access write to this state variable
+    bool isVarWritten(const std::string &var) const;
+
+    bool isVarConstant(const std::string &var) const;
+    const std::set<std::string> &getConstantVars() const{ return m_ConstantVars; }
+
+    //!< Neuron model state variables which are not substituted as constants
+    NewModels::Base::StringPairVec getNonConstantVars() const;
+
+    //!< Can the CPU update of this group share generated code with the update of other, i.e. do the
+    //!< groups only differ in parameter values and, if they have no spike queues, in size
+    bool canMerge(const NeuronGroup &other) const;
+
+    bool isParamHeterogeneous(size_t index) const{ return (index < m_HeterogeneousParams.size()) && m_HeterogeneousParams[index]; }
+    bool isDerivedParamHeterogeneous(size_t index) const{ return (index < m_HeterogeneousDerivedParams.size()) && m_HeterogeneousDerivedParams[index]; }
+
     void addExtraGlobalParams(std::map<std::string, std::string> &kernelParameters) const;
 
     // **THINK** do this really belong here - it is very code-generation specific
     std::string getQueueOffset(const std::string &devPrefix) const;
+    std::string getRuntimeParamsName() const{ return "runtimeParams" + getName(); }
 
 private:
     //------------------------------------------------------------------------
@@ -146,6 +207,30 @@ private:
     //!< Whether indidividual state variables of a neuron group should use zero-copied memory
     std::set<string> m_VarZeroCopyEnabled;
 
+    //!< Names of the parameters, and the derived parameters depending on them, which are kept as runtime values
+    std::set<string> m_RuntimeParams;
+
+    //!< Names of the state variables which are substituted as constants with their initial values
+    std::set<string> m_ConstantVars;
+
+    //!< Which parameters differ between the neuron groups this group is merged with and are read from the merged group table
+    std::vector<bool> m_HeterogeneousParams;
+
+    //!< Which derived parameters differ between the neuron groups this group is merged with and are read from the merged group table
+    std::vector<bool> m_HeterogeneousDerivedParams;
+
+    //!< Number of frames in the input queue of this neuron group (0 if disabled)
+    unsigned int m_InputQueueCapacity;
+
+    //!< Whether spikes are recorded by the multi-step stepTimeCPU(numSteps) and stepTimeGPU(numSteps)
+    bool m_SpikeRecordingEnabled;
+
+    //!< Number of time steps between updates of this group
+    unsigned int m_UpdatePeriod;
+
+    //!< Whether the update of this group is skipped while it is at rest
+    bool m_QuiescenceSkippingEnabled;
+
     //!< The ID of the cluster node which the neuron groups are computed on
     int m_HostID;
 
@@ -20,6 +20,7 @@ public:
                       The code will refer to $(NN) for the value of the variable with name "NN". It needs to refer to the predefined variable "ISYN", i.e. contain $(ISYN), if it is to receive input. */
     string thresholdConditionCode; /*!< \brief Code evaluating to a bool (e.g. "V > 20") that defines the condition for a true spike in the described neuron model */
     string resetCode; /*!< \brief Code that defines the reset action taken after a spike occurred. This can be empty */
+    string restConditionCode; //!< \brief Code evaluating to a bool (e.g. "fabs(V + 60) < 0.01") that is true when the neuron is at a resting fixed point which it only leaves if it receives input. This can be empty, in which case NeuronGroup::setQuiescenceSkippingEnabled cannot be used
     string supportCode; //!< \brief Support code is made available within the neuron kernel definition file and is meant to contain user defined device functions that are used in the neuron codes. Preprocessor defines are also allowed if appropriately safeguarded against multiple definition by using ifndef; functions should be declared as "__host__ __device__" to be available for both GPU and CPU versions
     vector<string> varNames; //!< Names of the variables in the neuron model
     vector<string> tmpVarNames; //!< never used
@@ -2,6 +2,7 @@
 
 // Standard includes
 #include <array>
+#include <cmath>
 #include <functional>
 #include <string>
 #include <tuple>
@@ -18,6 +19,7 @@
 #define SET_SIM_CODE(SIM_CODE) virtual std::string getSimCode() const{ return SIM_CODE; }
 #define SET_THRESHOLD_CONDITION_CODE(THRESHOLD_CONDITION_CODE) virtual std::string getThresholdConditionCode() const{ return THRESHOLD_CONDITION_CODE; }
 #define SET_RESET_CODE(RESET_CODE) virtual std::string getResetCode() const{ return RESET_CODE; }
+#define SET_REST_CONDITION_CODE(REST_CONDITION_CODE) virtual std::string getRestConditionCode() const{ return REST_CONDITION_CODE; }
 #define SET_SUPPORT_CODE(SUPPORT_CODE) virtual std::string getSupportCode() const{ return SUPPORT_CODE; }
 #define SET_EXTRA_GLOBAL_PARAMS(...) virtual StringPairVec getExtraGlobalParams() const{ return __VA_ARGS__; }
 
@@ -45,6 +47,12 @@ public:
     //! Gets code that defines the reset action taken after a spike occurred. This can be empty
     virtual std::string getResetCode() const{ return ""; }
 
+    //! Gets code which defines the condition for the neuron to be at rest.
+    /*! This evaluates to a bool (e.g. "fabs(V + 60) < 0.01") which is true when the state of the neuron is at a fixed
+        point which it only leaves if it receives input. This can be empty, in which case quiescence skipping
+        (see NeuronGroup::setQuiescenceSkippingEnabled) cannot be used with the model. */
+    virtual std::string getRestConditionCode() const{ return ""; }
+
     //! Gets support code to be made available within the neuron kernel/funcion.
     /*! This is intended to contain user defined device functions that are used in the neuron codes.
         Preprocessor defines are also allowed if appropriately safeguarded against multiple definition by using ifndef;
@@ -83,6 +91,9 @@ public:
     //! \copydoc Base::getResetCode
     virtual std::string getResetCode() const;
 
+    //! \copydoc Base::getRestConditionCode
+    virtual std::string getRestConditionCode() const;
+
     //! \copydoc Base::getSupportCode
     virtual std::string getSupportCode() const;
 
@@ -231,13 +242,16 @@ public:
 //----------------------------------------------------------------------------
 //! Empty neuron which allows setting spikes from external sources
 /*! This model does not contain any update code and can be used to implement
-    the equivalent of a SpikeGeneratorGroup in Brian or a SpikeSourceArray in PyNN. */
+    the equivalent of a SpikeGeneratorGroup in Brian or a SpikeSourceArray in PyNN.
+    It is always at rest so, with quiescence skipping enabled, its update is skipped entirely. */
 class SpikeSource : public Base
 {
 public:
     DECLARE_MODEL(NeuronModels::SpikeSource, 0, 0);
 
     SET_THRESHOLD_CONDITION_CODE("0");
+
+    SET_REST_CONDITION_CODE("1");
 };
 
 //----------------------------------------------------------------------------
@@ -522,4 +536,120 @@ public:
 
     SET_PARAM_NAMES({"gNa", "ENa", "gK", "EK", "gl", "El", "C", "ntimes"});
 };
+
+//----------------------------------------------------------------------------
+// NeuronModels::TraubMilesAdaptive
+//----------------------------------------------------------------------------
+//! Hodgkin-Huxley neurons with Traub & Miles algorithm and adaptive substeps.
+/*! Same equations as the standard TraubMiles model but, rather than taking a fixed number of
+    Euler substeps per network time step, each neuron is integrated with an embedded Heun-Euler
+    pair whose substep is adapted to keep the estimated local error below \c errTol. Neurons
+    at rest take a single substep of `DT` while spiking neurons take substeps as small as
+    `DT / maxSubsteps`, which bounds the number of accepted substeps per time step.
+
+    It has 5 variables:
+
+    - \c V - membrane potential E
+    - \c m - probability for Na channel activation m
+    - \c h - probability for not Na channel blocking h
+    - \c n - probability for K channel activation n
+    - \c substep - substep size the next time step starts with - initialise to 0 to start with `DT`
+
+    and 9 parameters:
+
+    - \c gNa - Na conductance in 1/(mOhms * cm^2)
+    - \c ENa - Na equi potential in mV
+    - \c gK - K conductance in 1/(mOhms * cm^2)
+    - \c EK - K equi potential in mV
+    - \c gl - Leak conductance in 1/(mOhms * cm^2)
+    - \c El - Leak equi potential in mV
+    - \c Cmem - Membrane capacity density in muF/cm^2
+    - \c errTol - tolerated local error of V per substep in mV - errors of m, h and n are scaled by 100mV, the approximate range of V
+    - \c maxSubsteps - maximum number of substeps per time step*/
+class TraubMilesAdaptive : public TraubMiles
+{
+public:
+    DECLARE_MODEL(NeuronModels::TraubMilesAdaptive, 9, 5);
+
+    virtual std::string getSimCode() const;
+
+    SET_PARAM_NAMES({"gNa", "ENa", "gK", "EK", "gl", "El", "C", "errTol", "maxSubsteps"});
+    SET_DERIVED_PARAMS({{"minSubstep", [](const vector<double> &pars, double dt){ return dt / pars[8]; }}});
+    SET_VARS({{"V", "scalar"}, {"m", "scalar"}, {"h", "scalar"}, {"n", "scalar"}, {"substep", "scalar"}});
+};
+
+//----------------------------------------------------------------------------
+// NeuronModels::TraubMilesAdaptiveRK3
+//----------------------------------------------------------------------------
+//! Hodgkin-Huxley neurons with Traub & Miles algorithm and adaptive third order substeps.
+/*! Same as TraubMilesAdaptive but integrated with the embedded Bogacki-Shampine 3(2) pair, which
+    costs four rather than two evaluations of the equations per substep but allows much larger
+    substeps during spikes for the same \c errTol.*/
+class TraubMilesAdaptiveRK3 : public TraubMilesAdaptive
+{
+public:
+    DECLARE_MODEL(NeuronModels::TraubMilesAdaptiveRK3, 9, 5);
+
+    virtual std::string getSimCode() const;
+};
+
+
+//----------------------------------------------------------------------------
+// NeuronModels::LIF
+//----------------------------------------------------------------------------
+//! Leaky integrate-and-fire neuron integrated exactly.
+/*! The subthreshold dynamics
+    \f{eqnarray*}{
+    \tau_m \frac{dV}{dt} &=& V_{\rm rest} - V + R_m (I_{\rm syn} + I_{\rm offset})
+    \f}
+    are linear, so with the input held constant over each time step they are integrated with the
+    exact propagator \f$\exp(-\Delta t/\tau_m)\f$, which is calculated once as a derived parameter.
+    Unlike forward Euler this is stable and accurate at any `DT` and needs no exp() call per step.
+    After a spike, V is held at \c Vreset for \c TauRefrac, counted in whole time steps.
+    Outside the refractory period, the neuron counts as at rest within 1 uV of its fixed point.
+
+    It has 2 variables:
+
+    - \c V - membrane potential in mV
+    - \c RefracSteps - number of time steps of the refractory period left
+
+    and 7 parameters:
+
+    - \c C - membrane capacitance in nF
+    - \c TauM - membrane time constant in ms
+    - \c Vrest - resting membrane potential in mV
+    - \c Vreset - reset potential in mV
+    - \c Vthresh - spiking threshold in mV
+    - \c Ioffset - offset current in nA
+    - \c TauRefrac - refractory period in ms*/
+class LIF : public Base
+{
+public:
+    DECLARE_MODEL(NeuronModels::LIF, 7, 2);
+
+    SET_SIM_CODE(
+        "if ($(RefracSteps) == 0) {\n"
+        "   scalar alpha= (($(Isyn) + $(Ioffset)) * $(Rmembrane)) + $(Vrest);\n"
+        "   $(V)= alpha - ($(ExpTC) * (alpha - $(V)));\n"
+        "}\n"
+        "else {\n"
+        "   $(RefracSteps)--;\n"
+        "}\n");
+
+    SET_THRESHOLD_CONDITION_CODE("$(RefracSteps) == 0 && $(V) >= $(Vthresh)");
+
+    SET_REST_CONDITION_CODE("$(RefracSteps) == 0 && fabs($(V) - $(Vrest) - ($(Ioffset) * $(Rmembrane))) < 1e-3");
+
+    SET_RESET_CODE(
+        "$(V)= $(Vreset);\n"
+        "$(RefracSteps)= (unsigned int)$(TauRefracSteps);\n");
+
+    SET_PARAM_NAMES({"C", "TauM", "Vrest", "Vreset", "Vthresh", "Ioffset", "TauRefrac"});
+    SET_DERIVED_PARAMS({
+        {"ExpTC", [](const vector<double> &pars, double dt){ return std::exp(-dt / pars[1]); }},
+        {"Rmembrane", [](const vector<double> &pars, double){ return pars[1] / pars[0]; }},
+        {"TauRefracSteps", [](const vector<double> &pars, double dt){ return std::round(pars[6] / dt); }}});
+
+    SET_VARS({{"V", "scalar"}, {"RefracSteps", "unsigned int"}});
+};
 } // NeuronModels
\ No newline at end of file
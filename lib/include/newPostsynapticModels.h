@@ -83,4 +83,30 @@ public:
 
     SET_PARAM_NAMES({"tau", "E"});
 };
+
+//----------------------------------------------------------------------------
+// PostsynapticModels::ExpCurr
+//----------------------------------------------------------------------------
+//! Exponential decay with synaptic input treated as a current value.
+/*! This model has no variables and a single parameter:
+  - \c tau : Decay time constant
+
+  \c tau is used by the derived parameter \c expDecay, the exact propagator exp(-dt/tau), and by
+  \c init, which scales the current so that the charge delivered by each input,
+  \f$\tau \times\f$ its weight, does not depend on `DT`. */
+class ExpCurr : public Base
+{
+public:
+    DECLARE_MODEL(ExpCurr, 1, 0);
+
+    SET_DECAY_CODE("$(inSyn)*=$(expDecay);");
+
+    SET_CURRENT_CONVERTER_CODE("$(init) * $(inSyn)");
+
+    SET_PARAM_NAMES({"tau"});
+
+    SET_DERIVED_PARAMS({
+        {"expDecay", [](const vector<double> &pars, double dt){ return std::exp(-dt / pars[0]); }},
+        {"init", [](const vector<double> &pars, double dt){ return (pars[0] * (1.0 - std::exp(-dt / pars[0]))) * (1.0 / dt); }}});
+};
 }
\ No newline at end of file
@@ -0,0 +1,166 @@
+#pragma once
+
+// Standard includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// GeNN includes
+#include "groupTiming.h"
+
+//----------------------------------------------------------------------------
+// RealTimePacer
+//----------------------------------------------------------------------------
+//! Paces time steps so that simulated time advances at a fixed ratio to wall-clock time
+/*! Used by generated code when NNmodel::setRealTimePacing(true) has been called.
+    The deadlines of the time steps of each call of run() are fixed when the call starts so
+    steps following an overrun run back to back until they are on time again rather than
+    the simulation drifting behind wall-clock time. Waits for a deadline are slept through
+    until spinSeconds before it, as the OS may wake the thread up late, and busy-waited for the rest. */
+class RealTimePacer
+{
+public:
+    //! Function called with the index of a time step and by how many seconds it overran its deadline
+    typedef void (*OverrunCallback)(unsigned long long step, double overrunSeconds);
+
+    RealTimePacer(double dt) : latency("realTime", "latency"), jitter("realTime", "jitter"),
+        m_StepSeconds(dt * 1.0E-3), m_Ratio(1.0), m_SpinSeconds(200.0E-6),
+        m_OverrunCallback(NULL), m_Core(-1), m_PinnedCore(-1)
+    {
+        reset();
+    }
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Set the number of simulated seconds per wall-clock second e.g. 0.5 runs at half speed
+    void setRatio(double ratio){ m_Ratio = ratio; }
+
+    //! Set how long before each deadline the pacer stops sleeping and starts busy-waiting
+    void setSpinSeconds(double spinSeconds){ m_SpinSeconds = spinSeconds; }
+
+    //! Set the function called whenever a time step overruns its deadline or NULL for none
+    void setOverrunCallback(OverrunCallback callback){ m_OverrunCallback = callback; }
+
+    //! Set the core the thread calling run() is pinned to or -1 to leave its affinity alone
+    void setCore(int core){ m_Core = core; }
+
+    //! Reset all recorded statistics
+    void reset()
+    {
+        latency.reset();
+        jitter.reset();
+        steps = 0;
+        deadlineMisses = 0;
+        maxLatencySeconds = 0.0;
+        maxJitterSeconds = 0.0;
+        maxOverrunSeconds = 0.0;
+    }
+
+    //! Run numSteps time steps by calling step, pacing them to wall-clock time
+    template<typename StepFunction>
+    void run(unsigned int numSteps, StepFunction step)
+    {
+        typedef std::chrono::steady_clock clock;
+        pin();
+
+        const clock::duration period = std::chrono::duration_cast<clock::duration>(
+            std::chrono::duration<double>(m_StepSeconds / m_Ratio));
+        const clock::duration spin = std::chrono::duration_cast<clock::duration>(
+            std::chrono::duration<double>(m_SpinSeconds));
+        clock::time_point scheduled = clock::now();
+        for(unsigned int s = 0; s < numSteps; s++) {
+            // Jitter is how late the step starts after its scheduled start
+            const clock::time_point start = clock::now();
+            jitter.add(start - scheduled);
+            maxJitterSeconds = std::max(maxJitterSeconds, toSeconds(start - scheduled));
+
+            step();
+
+            const clock::time_point end = clock::now();
+            latency.add(end - start);
+            maxLatencySeconds = std::max(maxLatencySeconds, toSeconds(end - start));
+
+            scheduled += period;
+            if (end > scheduled) {
+                const double overrun = toSeconds(end - scheduled);
+                deadlineMisses++;
+                maxOverrunSeconds = std::max(maxOverrunSeconds, overrun);
+                if (m_OverrunCallback != NULL) {
+                    m_OverrunCallback(steps, overrun);
+                }
+            }
+            else {
+                if ((scheduled - end) > spin) {
+                    std::this_thread::sleep_for(scheduled - end - spin);
+                }
+                while (clock::now() < scheduled) {
+                }
+            }
+            steps++;
+        }
+    }
+
+    //! Write the recorded statistics to an open file as a JSON object
+    void writeJSON(FILE *f)
+    {
+        fprintf(f, "{\"steps\": %llu, \"deadlineMisses\": %llu, \"maxLatency\": %.9e, \"maxJitter\": %.9e, \"maxOverrun\": %.9e,\n",
+                steps, deadlineMisses, maxLatencySeconds, maxJitterSeconds, maxOverrunSeconds);
+        fprintf(f, "\"stats\": ");
+        GroupTimingStats *const stats[2] = {&latency, &jitter};
+        writeGroupTimingJSON(f, stats, 2);
+        fprintf(f, "}\n");
+    }
+
+    GroupTimingStats latency;           //!< Wall-clock time taken by each time step
+    GroupTimingStats jitter;            //!< How late each time step started after its scheduled start
+    unsigned long long steps;           //!< Number of time steps run
+    unsigned long long deadlineMisses;  //!< Number of time steps which overran their deadline
+    double maxLatencySeconds;           //!< Longest time taken by a time step
+    double maxJitterSeconds;            //!< Latest start of a time step after its scheduled start
+    double maxOverrunSeconds;           //!< Longest overrun of a deadline
+
+private:
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    static double toSeconds(std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration<double>(duration).count();
+    }
+
+    //! Pin the calling thread to the requested core if it has changed since the last call
+    void pin()
+    {
+        if (m_Core < 0 || m_Core == m_PinnedCore) {
+            return;
+        }
+#ifdef __linux__
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(m_Core, &cpuSet);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) != 0) {
+            fprintf(stderr, "Warning: cannot pin real-time simulation thread to core %d\n", m_Core);
+        }
+#else
+        fprintf(stderr, "Warning: pinning the real-time simulation thread to a core is only supported on Linux\n");
+#endif
+        m_PinnedCore = m_Core;
+    }
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    double m_StepSeconds;
+    double m_Ratio;
+    double m_SpinSeconds;
+    OverrunCallback m_OverrunCallback;
+    int m_Core;
+    int m_PinnedCore;
+};
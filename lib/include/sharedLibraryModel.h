@@ -0,0 +1,197 @@
+#pragma once
+
+// Standard C++ includes
+#include <string>
+
+// Standard C includes
+#include <dlfcn.h>
+
+// GeNN includes
+#include "varDescriptor.h"
+
+//! Version of the C interface exported by shared libraries built with GENN_PREFERENCES::buildSharedLibrary
+/*! Incremented whenever a function is removed from the interface or its signature changes */
+#define GENN_SHARED_LIBRARY_ABI_VERSION 1
+
+//----------------------------------------------------------------------------
+// SharedLibraryModel
+//----------------------------------------------------------------------------
+//! Loads a model which was built into a shared library with GENN_PREFERENCES::buildSharedLibrary
+/*! All of the generated code's global state is hidden inside the shared library and only the
+    genn_ prefixed C functions are exported, so several models (or several builds of the same
+    model from different paths) can be loaded into one process side by side. Errors are
+    reported through return values rather than gennError so a failed load does not end the
+    hosting process. */
+class SharedLibraryModel
+{
+public:
+    SharedLibraryModel() : m_Library(NULL)
+    {
+        clearFunctions();
+    }
+
+    ~SharedLibraryModel()
+    {
+        close();
+    }
+
+    SharedLibraryModel(const SharedLibraryModel&) = delete;
+    SharedLibraryModel &operator=(const SharedLibraryModel&) = delete;
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    //! Load shared library at path, returning false (see getError) if it cannot be loaded or was built for a different interface version
+    bool open(const std::string &path)
+    {
+        close();
+
+        m_Library = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+        if(m_Library == NULL) {
+            m_Error = dlerror();
+            return false;
+        }
+
+        typedef unsigned int (*GetABIVersionFunc)();
+        GetABIVersionFunc getABIVersion = (GetABIVersionFunc)dlsym(m_Library, "genn_getABIVersion");
+        if(getABIVersion == NULL || getABIVersion() != GENN_SHARED_LIBRARY_ABI_VERSION) {
+            m_Error = path + " was not built with a compatible version of GeNN";
+            close();
+            return false;
+        }
+
+        if(!getSymbol("genn_getModelName", m_GetModelName) || !getSymbol("genn_allocateMem", m_AllocateMem)
+            || !getSymbol("genn_initialize", m_Initialize) || !getSymbol("genn_initModel", m_InitModel)
+            || !getSymbol("genn_stepTimeCPU", m_StepTimeCPU) || !getSymbol("genn_stepTimeCPUSteps", m_StepTimeCPUSteps)
+            || !getSymbol("genn_freeMem", m_FreeMem)
+            || !getSymbol("genn_getTimestep", m_GetTimestep) || !getSymbol("genn_setTimestep", m_SetTimestep)
+            || !getSymbol("genn_getTime", m_GetTime) || !getSymbol("genn_getVar", m_GetVar)
+            || !getSymbol("genn_getVarDescriptor", m_GetVarDescriptor) || !getSymbol("genn_getVarDescriptorTable", m_GetVarDescriptorTable)
+            || !getSymbol("genn_getNumVarDescriptors", m_GetNumVarDescriptors))
+        {
+            close();
+            return false;
+        }
+
+        // GPU functions are only exported by libraries built without CPU_ONLY
+        m_StepTimeGPU = (VoidFunc)dlsym(m_Library, "genn_stepTimeGPU");
+        m_StepTimeGPUSteps = (StepsFunc)dlsym(m_Library, "genn_stepTimeGPUSteps");
+        m_CopyStateToDevice = (VoidFunc)dlsym(m_Library, "genn_copyStateToDevice");
+        m_CopyStateFromDevice = (VoidFunc)dlsym(m_Library, "genn_copyStateFromDevice");
+        return true;
+    }
+
+    //! Unload shared library - the model's memory should have been freed with freeMem first
+    void close()
+    {
+        if(m_Library != NULL) {
+            dlclose(m_Library);
+            m_Library = NULL;
+        }
+        clearFunctions();
+    }
+
+    bool isOpen() const{ return (m_Library != NULL); }
+
+    //! Was the library built with GPU support i.e. are stepTimeGPU, copyStateToDevice and copyStateFromDevice available
+    bool isGPUAvailable() const{ return (m_StepTimeGPU != NULL); }
+
+    //! Description of the last error encountered by open
+    const std::string &getError() const{ return m_Error; }
+
+    //------------------------------------------------------------------------
+    // Model interface
+    //------------------------------------------------------------------------
+    const char *getModelName() const{ return m_GetModelName(); }
+    void allocateMem(){ m_AllocateMem(); }
+    void initialize(){ m_Initialize(); }
+    void initModel(){ m_InitModel(); }  //!< Calls the generated init<model name>() function
+    void stepTimeCPU(){ m_StepTimeCPU(); }
+    void stepTimeCPU(unsigned int numSteps){ m_StepTimeCPUSteps(numSteps); }   //!< Calls the generated stepTimeCPU(numSteps)
+    void stepTimeGPU(){ m_StepTimeGPU(); }
+    void stepTimeGPU(unsigned int numSteps){ m_StepTimeGPUSteps(numSteps); }   //!< Calls the generated stepTimeGPU(numSteps)
+    void copyStateToDevice(){ m_CopyStateToDevice(); }
+    void copyStateFromDevice(){ m_CopyStateFromDevice(); }
+    void freeMem(){ m_FreeMem(); }
+
+    unsigned long long getTimestep() const{ return m_GetTimestep(); }
+    void setTimestep(unsigned long long timestep){ m_SetTimestep(timestep); }   //!< Sets iT and t=iT*DT e.g. to restart a simulation after initialize()
+    double getTime() const{ return m_GetTime(); }
+
+    //! Get host pointer to a state array by the name it has in the generated definitions.h (e.g. "VPop" or "glbSpkCntPop") or NULL if there is no such array
+    /*! Sparse connectivity is returned as a pointer to the SparseProjection of the same name (e.g. "CSyn") */
+    template<typename T>
+    T *getVar(const char *name) const{ return (T*)m_GetVar(name); }
+
+    //! Get descriptor of variable name of group (e.g. "V" of "PExc") or NULL if there is no such array
+    const VarDescriptor *getVarDescriptor(const char *name, const char *group) const{ return m_GetVarDescriptor(name, group); }
+
+    //! Get table describing all of the model's state arrays
+    const VarDescriptor *getVarDescriptorTable() const{ return m_GetVarDescriptorTable(); }
+    unsigned int getNumVarDescriptors() const{ return m_GetNumVarDescriptors(); }
+
+private:
+    typedef void (*VoidFunc)();
+    typedef void (*StepsFunc)(unsigned int);
+
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    template<typename F>
+    bool getSymbol(const char *name, F &function)
+    {
+        function = (F)dlsym(m_Library, name);
+        if(function == NULL) {
+            m_Error = std::string("Cannot find ") + name + " in shared library";
+            return false;
+        }
+        return true;
+    }
+
+    void clearFunctions()
+    {
+        m_GetModelName = NULL;
+        m_AllocateMem = NULL;
+        m_Initialize = NULL;
+        m_InitModel = NULL;
+        m_StepTimeCPU = NULL;
+        m_StepTimeCPUSteps = NULL;
+        m_StepTimeGPU = NULL;
+        m_StepTimeGPUSteps = NULL;
+        m_CopyStateToDevice = NULL;
+        m_CopyStateFromDevice = NULL;
+        m_FreeMem = NULL;
+        m_GetTimestep = NULL;
+        m_SetTimestep = NULL;
+        m_GetTime = NULL;
+        m_GetVar = NULL;
+        m_GetVarDescriptor = NULL;
+        m_GetVarDescriptorTable = NULL;
+        m_GetNumVarDescriptors = NULL;
+    }
+
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    void *m_Library;
+    std::string m_Error;
+
+    const char *(*m_GetModelName)();
+    VoidFunc m_AllocateMem;
+    VoidFunc m_Initialize;
+    VoidFunc m_InitModel;
+    VoidFunc m_StepTimeCPU;
+    StepsFunc m_StepTimeCPUSteps;
+    VoidFunc m_StepTimeGPU;
+    StepsFunc m_StepTimeGPUSteps;
+    VoidFunc m_CopyStateToDevice;
+    VoidFunc m_CopyStateFromDevice;
+    VoidFunc m_FreeMem;
+    unsigned long long (*m_GetTimestep)();
+    void (*m_SetTimestep)(unsigned long long);
+    double (*m_GetTime)();
+    void *(*m_GetVar)(const char*);
+    const VarDescriptor *(*m_GetVarDescriptor)(const char*, const char*);
+    const VarDescriptor *(*m_GetVarDescriptorTable)();
+    unsigned int (*m_GetNumVarDescriptors)();
+};
@@ -65,6 +65,14 @@ void neuronThresholdCondition(
     const ExtraGlobalParamNameIterCtx &nmExtraGlobalParams,
     const std::string &ftype);
 
+void neuronRestCondition(
+    std::string &rCode,
+    const NeuronGroup &ng,
+    const VarNameIterCtx &nmVars,
+    const DerivedParamNameIterCtx &nmDerivedParams,
+    const ExtraGlobalParamNameIterCtx &nmExtraGlobalParams,
+    const std::string &ftype);
+
 void neuronSim(
     std::string &sCode,
     const NeuronGroup &ng,
@@ -26,7 +26,7 @@ public:
         m_SrcNeuronGroup(srcNeuronGroup), m_TrgNeuronGroup(trgNeuronGroup),
         m_TrueSpikeRequired(false), m_SpikeEventRequired(false), m_EventThresholdReTestRequired(false),
         m_WUModel(wu), m_WUParams(wuParams), m_WUInitVals(wuInitVals), m_PSModel(ps), m_PSParams(psParams), m_PSInitVals(psInitVals),
-        m_HostID(0), m_DeviceID(0)
+        m_UpdatePeriod(1), m_PSLazyDecayEnabled(false), m_MaxDendriticDelaySteps(0), m_HostID(0), m_DeviceID(0)
     {
     }
 
@@ -56,11 +56,30 @@ public:
     //!< Function to enable the use zero-copied memory for a particular postsynaptic model state variable
     //!< May improve IO performance at the expense of kernel performance
     void setPSVarZeroCopyEnabled(const std::string &varName, bool enabled);
+
+    //!< Function to keep a weight update model parameter as a runtime value, which can be changed between time steps
+    //!< with a generated setter function, rather than substituting it into the generated code as a constant
+    void setWUParamRuntimeEnabled(const std::string &paramName, bool enabled);
+
+    //!< Function to only run the synapse dynamics of this group on every numSteps'th time step, advancing it by
+    //!< numSteps * DT each time. Spikes are still propagated on every time step
+    void setUpdatePeriod(unsigned int numSteps);
+
+    //!< Function to decay the input of an exponentially decaying postsynaptic model through one scale factor shared by the
+    //!< whole group rather than rewriting the input of every postsynaptic neuron on every time step (CPU only)
+    void setPSLazyDecayEnabled(bool enabled);
+
+    //!< Function to delay the input of each synapse by the number of time steps held in its weight update model variable varName,
+    //!< which must be less than maxDelaySteps, by adding it to a ring buffer of maxDelaySteps slots of postsynaptic input (CPU only)
+    void setDendriticDelay(const std::string &varName, unsigned int maxDelaySteps);
     void setClusterIndex(int hostID, int deviceID){ m_HostID = hostID; m_DeviceID = deviceID; }
 
     void setMaxConnections(unsigned int maxConnections);
     void setSpanType(SpanType spanType);
 
+    //!< Marks the weight update model variables which are substituted as constants with their initial values rather than stored in arrays
+    void setConstantWUVars(const std::set<std::string> &vars){ m_ConstantWUVars = vars; }
+
     void initDerivedParams(double dt);
     void calcKernelSizes(unsigned int blockSize, unsigned int &paddedKernelIDStart);
 
@@ -98,10 +117,32 @@ public:
     const std::vector<double> &getPSDerivedParams() const{ return m_PSDerivedParams; }
     const std::vector<double> &getPSInitVals() const{ return m_PSInitVals; }
 
+    unsigned int getUpdatePeriod() const{ return m_UpdatePeriod; }
+
+    bool isPSLazyDecayEnabled() const{ return m_PSLazyDecayEnabled; }
+
+    bool isDendriticDelayRequired() const{ return (m_MaxDendriticDelaySteps > 0); }
+    unsigned int getMaxDendriticDelaySteps() const{ return m_MaxDendriticDelaySteps; }
+    const std::string &getDendriticDelayVar() const{ return m_DendriticDelayVar; }
+
     bool isZeroCopyEnabled() const;
     bool isWUVarZeroCopyEnabled(const std::string &var) const;
     bool isPSVarZeroCopyEnabled(const std::string &var) const;
 
+    bool isWUParamRuntimeEnabled(const std::string &param) const;
+    bool isWURuntimeParamsRequired() const{ return !m_WURuntimeParams.empty(); }
+    const std::set<std::string> &getWURuntimeParams() const{ return m_WURuntimeParams; }
+    std::string getWURuntimeParamsName() const{ return "wuRuntimeParams" + getName(); }
+
+    //!< May any weight update model code snippet write to $(name) e.g. a weight update model variable or a neuron variable with _pre or _post suffix
+    bool isWUCodeWriting(const std::string &name) const;
+
+    bool isWUVarConstant(const std::string &var) const;
+    const std::set<std::string> &getConstantWUVars() const{ return m_ConstantWUVars; }
+
+    //!< Weight update model variables which are not substituted as constants
+    NewModels::Base::StringPairVec getNonConstantWUVars() const;
+
     //!< Is this synapse group too large to use shared memory for combining postsynaptic output
     // **THINK** this is very cuda-specific
     bool isPSAtomicAddRequired(unsigned int blockSize) const;
@@ -190,6 +231,24 @@ private:
     //!< Whether indidividual state variables of post synapse should use zero-copied memory
     std::set<string> m_PSVarZeroCopyEnabled;
 
+    //!< Names of the weight update model parameters, and the derived parameters depending on them, which are kept as runtime values
+    std::set<string> m_WURuntimeParams;
+
+    //!< Names of the weight update model variables which are substituted as constants with their initial values
+    std::set<string> m_ConstantWUVars;
+
+    //!< Number of time steps between runs of the synapse dynamics of this group
+    unsigned int m_UpdatePeriod;
+
+    //!< Whether the input of this group is decayed lazily
+    bool m_PSLazyDecayEnabled;
+
+    //!< Number of slots in the ring buffer of delayed postsynaptic input or zero if the input is not delayed
+    unsigned int m_MaxDendriticDelaySteps;
+
+    //!< Name of the weight update model variable holding the delay of each synapse in time steps
+    std::string m_DendriticDelayVar;
+
     //!< The ID of the cluster node which the synapse group is computed on
     int m_HostID;
 
@@ -0,0 +1,45 @@
+#pragma once
+
+// Standard C includes
+#include <cstddef>
+#include <cstring>
+
+//----------------------------------------------------------------------------
+// VarDescriptor
+//----------------------------------------------------------------------------
+//! Description of one state array of a generated model
+/*! The generated runner contains a table of these (varDescriptorTable) covering every array allocated by
+    allocateMem() and allocate<synapse group>() so that generic tools such as recorders or checkpointing can
+    find arrays by variable and group name with getVarDescriptor() rather than hard-coding names like VPExc.
+    Pointers are read through the addresses of the generated pointer variables, so they are valid whenever the
+    arrays are allocated. */
+struct VarDescriptor
+{
+    const char *name;               //!< Name of variable e.g. "V", "inSyn", "glbSpkCnt" or "ind" for the ind array of a sparse projection
+    const char *group;              //!< Name of neuron or synapse group the array belongs to
+    const char *type;               //!< Element type e.g. "float" or "unsigned int"
+    size_t elementSize;             //!< Size of one element in bytes
+    size_t count;                   //!< Number of elements including all delay slots and instances of a batched model - per connection if the array is sized by connN
+    const unsigned int *connN;      //!< Number of connections of the sparse projection the array is sized by, otherwise NULL
+    void *const *hostPtr;           //!< Address of host pointer
+    void *const *devicePtr;         //!< Address of device pointer - NULL in CPU_ONLY builds
+
+    size_t getCount() const{ return (connN != NULL) ? (*connN * count) : count; }
+    size_t getSizeBytes() const{ return getCount() * elementSize; }
+    void *getHostPointer() const{ return *hostPtr; }
+    void *getDevicePointer() const{ return (devicePtr != NULL) ? *devicePtr : NULL; }
+};
+
+//----------------------------------------------------------------------------
+// Functions
+//----------------------------------------------------------------------------
+//! Find the descriptor of variable name of group in a table of numDescriptors descriptors or return NULL if there is none
+inline const VarDescriptor *findVarDescriptor(const VarDescriptor *table, unsigned int numDescriptors, const char *name, const char *group)
+{
+    for(unsigned int i = 0; i < numDescriptors; i++) {
+        if(strcmp(table[i].name, name) == 0 && strcmp(table[i].group, group) == 0) {
+            return &table[i];
+        }
+    }
+    return NULL;
+}
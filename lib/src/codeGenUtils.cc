@@ -1,23 +1,8 @@
 #include "codeGenUtils.h"
 
-// Is C++ regex library operational?
-// We assume it is for:
-// 1) Non GCC compilers
-// 2) GCC 5.X.X and future
-// 3) Any future (4.10.X?) releases
-// 4) 4.9.1 and subsequent patch releases (GCC fully implemented regex in 4.9.0
-// BUT bug 61227 https://gcc.gnu.org/bugzilla/show_bug.cgi?id=61227 prevented \w from working)
-#if !defined(__GNUC__) || \
-    __GNUC__ > 4 || \
-    (__GNUC__ == 4 && (__GNUC_MINOR__ > 9 || \
-                      (__GNUC_MINOR__ == 9 && __GNUC_PATCHLEVEL__ >= 1)))
-    #define REGEX_OPERATIONAL
-#endif
-
 // Standard includes
-#ifdef REGEX_OPERATIONAL
-#include <regex>
-#endif
+#include <algorithm>
+#include <cctype>
 
 // GeNN includes
 #include "modelSpec.h"
@@ -194,6 +179,43 @@ void doFinal(string &code, unsigned int i, const string &type, unsigned int &sta
         }
     }
 }
+
+//--------------------------------------------------------------------------
+/*! \brief Find the next $(name) token, where name consists only of word characters, at or after pos.
+  Returns the position of the '$' or string::npos and sets end to the position of the closing bracket.
+ */
+//--------------------------------------------------------------------------
+size_t findToken(const string &code, size_t pos, size_t &end)
+{
+    size_t found= code.find("$(", pos);
+    while (found != string::npos) {
+        end= found + 2;
+        while ((end < code.size()) && (isalnum((unsigned char) code[end]) || (code[end] == '_'))) {
+            end++;
+        }
+        if ((end > found + 2) && (end < code.size()) && (code[end] == ')')) {
+            return found;
+        }
+        found= code.find("$(", found + 1);
+    }
+    return string::npos;
+}
+
+//--------------------------------------------------------------------------
+/*! \brief This function raises a gennError listing the variables that remain unreplaced in code
+ */
+//--------------------------------------------------------------------------
+void unreplacedVariablesError(const vector<string> &names, const string &codeName)
+{
+    string vars= "";
+    for (const auto &n : names) {
+        vars+= n + ", ";
+    }
+    vars= vars.substr(0, vars.size()-2);
+    if (vars.find(",") != string::npos) vars= "variables "+vars+" were ";
+    else vars= "variable "+vars+" was ";
+    gennError("The "+vars+"undefined in code "+codeName+".");
+}
 }    // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -202,10 +224,57 @@ void doFinal(string &code, unsigned int i, const string &type, unsigned int &sta
 
 void substitute(string &s, const string &trg, const string &rep)
 {
+    // Continue searching after each replacement rather than from the start of the string
     size_t found= s.find(trg);
     while (found != string::npos) {
         s.replace(found,trg.length(),rep);
-        found= s.find(trg);
+        found= s.find(trg, found + rep.length());
+    }
+}
+
+//--------------------------------------------------------------------------
+//! \brief Substitute all bound $(name) tokens in code in a single pass
+//--------------------------------------------------------------------------
+
+void CodeSubstitutions::apply(string &code, vector<string> *unresolved) const
+{
+    string out;
+    size_t copied= 0;
+    size_t end= 0;
+    size_t found= findToken(code, 0, end);
+    while (found != string::npos) {
+        const string name= code.substr(found + 2, end - found - 2);
+        const auto b= m_Bindings.find(name);
+        if (b != m_Bindings.end()) {
+            // Allocate output buffer on first substitution
+            if (out.empty()) {
+                out.reserve(code.size() + code.size() / 2);
+            }
+
+            // Copy code up to token followed by replacement
+            out.append(code, copied, found - copied);
+            out.append(b->second);
+            copied= end + 1;
+        }
+        else if (unresolved != NULL) {
+            unresolved->push_back(name);
+        }
+        found= findToken(code, end + 1, end);
+    }
+
+    // If any tokens were replaced, copy remainder of code and swap
+    if (copied > 0) {
+        out.append(code, copied, string::npos);
+        code.swap(out);
+    }
+}
+
+void CodeSubstitutions::applyChecked(string &code, const string &codeName) const
+{
+    vector<string> unresolved;
+    apply(code, &unresolved);
+    if (!unresolved.empty()) {
+        unreplacedVariablesError(unresolved, codeName);
     }
 }
 
@@ -312,8 +381,6 @@ string ensureFtype(const string &oldcode, const string &type)
 }
 
 
-#ifdef REGEX_OPERATIONAL
-
 //--------------------------------------------------------------------------
 /*! \brief This function checks for unknown variable definitions and returns a gennError if any are found
  */
@@ -321,25 +388,153 @@ string ensureFtype(const string &oldcode, const string &type)
 
 void checkUnreplacedVariables(const string &code, const string &codeName)
 {
-    regex rgx("\\$\\([\\w]+\\)");
-    string vars= "";
-    for (sregex_iterator it(code.begin(), code.end(), rgx), end; it != end; it++) {
-        vars+= it->str().substr(2,it->str().size()-3) + ", ";
+    vector<string> names;
+    size_t end= 0;
+    for (size_t found= findToken(code, 0, end); found != string::npos; found= findToken(code, end + 1, end)) {
+        names.push_back(code.substr(found + 2, end - found - 2));
+    }
+    if (!names.empty()) {
+        unreplacedVariablesError(names, codeName);
+    }
+}
+
+
+//--------------------------------------------------------------------------
+/*! \brief This function checks whether code may write to $(name) i.e. assigns to, increments, decrements or takes the address of it
+ */
+//--------------------------------------------------------------------------
+
+bool isVarAssigned(const string &code, const string &name)
+{
+    const string token = "$(" + name + ")";
+    const char *whitespace = " \t\r\n";
+    for (size_t pos = code.find(token); pos != string::npos; pos = code.find(token, pos + token.size())) {
+        // Check for assignment, compound assignment or postfix increment/decrement following token
+        const size_t after = code.find_first_not_of(whitespace, pos + token.size());
+        if (after != string::npos) {
+            const string op = code.substr(after, 3);
+            if ((op[0] == '=' && op.compare(0, 2, "==") != 0)
+                || op.compare(0, 2, "++") == 0 || op.compare(0, 2, "--") == 0
+                || (op.size() > 1 && op[1] == '=' && string("+-*/%&|^").find(op[0]) != string::npos)
+                || op == "<<=" || op == ">>=")
+            {
+                return true;
+            }
+        }
+
+        // Check for prefix increment/decrement or address-of operator preceding token
+        const size_t before = (pos == 0) ? string::npos : code.find_last_not_of(whitespace, pos - 1);
+        if (before != string::npos) {
+            if (before > 0 && (code.compare(before - 1, 2, "++") == 0 || code.compare(before - 1, 2, "--") == 0)) {
+                return true;
+            }
+            if (code[before] == '&' && (before == 0 || code[before - 1] != '&')) {
+                return true;
+            }
+        }
     }
-    if (vars.size() > 0) {
-        vars= vars.substr(0, vars.size()-2);
-        if (vars.find(",") != string::npos) vars= "variables "+vars+" were ";
-        else vars= "variable "+vars+" was ";
-        gennError("The "+vars+"undefined in code "+codeName+".");
+    return false;
+}
+
+
+//--------------------------------------------------------------------------
+/*! \brief This function replaces DT in the code of a group which is only updated every updatePeriod time steps with the time the group advances by in each update
+ */
+//--------------------------------------------------------------------------
+
+void substituteUpdatePeriodDT(string &code, unsigned int updatePeriod)
+{
+    if (updatePeriod == 1) {
+        return;
+    }
+
+    // Only replace DT where it is a whole identifier
+    const string rep = "(" + to_string(updatePeriod) + " * DT)";
+    const auto isIdentifierChar = [](char c){ return isalnum((unsigned char) c) || (c == '_'); };
+    for (size_t pos = code.find("DT"); pos != string::npos; pos = code.find("DT", pos)) {
+        if ((pos > 0 && isIdentifierChar(code[pos - 1])) || (pos + 2 < code.size() && isIdentifierChar(code[pos + 2]))) {
+            pos += 2;
+        }
+        else {
+            code.replace(pos, 2, rep);
+            pos += rep.size();
+        }
     }
 }
-#else
-void checkUnreplacedVariables(const string &, const string &)
+
+
+//--------------------------------------------------------------------------
+/*! \brief This function checks whether postsynaptic decay code only multiplies $(inSyn) by a factor which depends on nothing but the given parameters
+ */
+//--------------------------------------------------------------------------
+
+bool isExponentialDecayCode(const string &decayCode, const vector<string> &paramNames)
 {
+    // Remove whitespace and the closing semicolon e.g. "$(inSyn) *= $(expDecay);\n" becomes "$(inSyn)*=$(expDecay)"
+    string code;
+    for (char c : decayCode) {
+        if (!isspace((unsigned char) c)) {
+            code += c;
+        }
+    }
+    if (!code.empty() && code.back() == ';') {
+        code.pop_back();
+    }
+
+    const string prefix = "$(inSyn)*=";
+    if (code.compare(0, prefix.size(), prefix) != 0 || code.size() == prefix.size()) {
+        return false;
+    }
+    const string f = code.substr(prefix.size());
+    if (f.find(';') != string::npos) {
+        return false;
+    }
+
+    // Every $(name) in the factor must be a parameter so it is the same on every time step
+    for (size_t pos = f.find("$("); pos != string::npos; pos = f.find("$(", pos)) {
+        const size_t end = f.find(')', pos);
+        if (end == string::npos
+            || find(paramNames.begin(), paramNames.end(), f.substr(pos + 2, end - pos - 2)) == paramNames.end())
+        {
+            return false;
+        }
+        pos = end;
+    }
+    return true;
 }
-#endif
 
 
+//--------------------------------------------------------------------------
+/*! \brief Function for adding the derived parameters whose values change with those of any of the runtime parameters to runtimeParams.
+ */
+//--------------------------------------------------------------------------
+
+void addRuntimeDerivedParams(const string &groupName, const vector<string> &paramNames, const vector<double> &params,
+                             const NewModels::Base::DerivedParamVec &derivedParams, const vector<double> &derivedParamValues,
+                             double dt, set<string> &runtimeParams)
+{
+    for (size_t p = 0; p < paramNames.size() && p < params.size(); p++) {
+        if (runtimeParams.find(paramNames[p]) == runtimeParams.end()) {
+            continue;
+        }
+
+        // Recalculate every derived parameter with two other values of this parameter, of the same sign where possible
+        vector<double> lowerParams(params), upperParams(params);
+        lowerParams[p] = (params[p] == 0.0) ? -1.0 : (params[p] * 0.5);
+        upperParams[p] = (params[p] == 0.0) ? 1.0 : (params[p] * 2.0);
+        for (size_t d = 0; d < derivedParams.size() && d < derivedParamValues.size(); d++) {
+            const auto &derived = derivedParams[d];
+            if (runtimeParams.find(derived.first) == runtimeParams.end()
+                && (derived.second(lowerParams, dt) != derivedParamValues[d] || derived.second(upperParams, dt) != derivedParamValues[d]))
+            {
+                cerr << "Warning: derived parameter " << derived.first << " of group " << groupName << " depends on runtime parameter " << paramNames[p];
+                cerr << " - it is kept as a runtime value and has to be updated with set" << derived.first << groupName << "() whenever " << paramNames[p] << " changes" << endl;
+                runtimeParams.insert(derived.first);
+            }
+        }
+    }
+}
+
 //-------------------------------------------------------------------------
 /*!
   \brief Function for performing the code and value substitutions necessary to insert neuron related variables, parameters, and extraGlobal parameters into synaptic code.
@@ -354,49 +549,79 @@ void neuron_substitutions_in_synaptic_code(
     const string &devPrefix //!< device prefix, "dd_" for GPU, nothing for CPU
     )
 {
+    CodeSubstitutions substitutions;
+    neuron_substitutions_in_synaptic_code(substitutions, sg, preIdx, postIdx, devPrefix);
+    substitutions.apply(wCode);
+}
+
+void neuron_substitutions_in_synaptic_code(
+    CodeSubstitutions &substitutions, //!< the substitutions to add to
+    const SynapseGroup *sg,
+    const string &preIdx, //!< index of the pre-synaptic neuron to be accessed for _pre variables; differs for different Span)
+    const string &postIdx, //!< index of the post-synaptic neuron to be accessed for _post variables; differs for different Span)
+    const string &devPrefix //!< device prefix, "dd_" for GPU, nothing for CPU
+    )
+{
 
     // presynaptic neuron variables, parameters, and global parameters
     const auto *srcNeuronModel = sg->getSrcNeuronGroup()->getNeuronModel();
     if (srcNeuronModel->isPoisson()) {
-        substitute(wCode, "$(V_pre)", to_string(sg->getSrcNeuronGroup()->getParams()[2]));
+        const string &vSpikeName = srcNeuronModel->getParamNames()[2];
+        substitutions.addVarSubstitution("V_pre", sg->getSrcNeuronGroup()->isParamRuntimeEnabled(vSpikeName)
+                                         ? sg->getSrcNeuronGroup()->getRuntimeParamsName() + "." + vSpikeName
+                                         : to_string(sg->getSrcNeuronGroup()->getParams()[2]));
     }
-    substitute(wCode, "$(sT_pre)", devPrefix+ "sT" + sg->getSrcNeuronGroup()->getName() + "[" + sg->getOffsetPre() + preIdx + "]");
-    for(const auto &v : srcNeuronModel->getVars()) {
-        if (sg->getSrcNeuronGroup()->isVarQueueRequired(v.first)) {
-            substitute(wCode, "$(" + v.first + "_pre)",
-                       devPrefix + v.first + sg->getSrcNeuronGroup()->getName() + "[" + sg->getOffsetPre() + preIdx + "]");
+    substitutions.addVarSubstitution("sT_pre", devPrefix+ "sT" + sg->getSrcNeuronGroup()->getName() + "[" + sg->getOffsetPre() + preIdx + "]");
+    const auto preVars = srcNeuronModel->getVars();
+    for(size_t i = 0; i < preVars.size(); i++) {
+        const auto &v = preVars[i];
+        if (sg->getSrcNeuronGroup()->isVarConstant(v.first)) {
+            substitutions.addVarSubstitution(v.first + "_pre", valueToString(sg->getSrcNeuronGroup()->getInitVals()[i]));
+        }
+        else if (sg->getSrcNeuronGroup()->isVarQueueRequired(v.first)) {
+            substitutions.addVarSubstitution(v.first + "_pre",
+                                             devPrefix + v.first + sg->getSrcNeuronGroup()->getName() + "[" + sg->getOffsetPre() + preIdx + "]");
         }
         else {
-            substitute(wCode, "$(" + v.first + "_pre)",
-                       devPrefix + v.first + sg->getSrcNeuronGroup()->getName() + "[" + preIdx + "]");
+            substitutions.addVarSubstitution(v.first + "_pre",
+                                             devPrefix + v.first + sg->getSrcNeuronGroup()->getName() + "[" + preIdx + "]");
         }
     }
-    value_substitutions(wCode, srcNeuronModel->getParamNames(), sg->getSrcNeuronGroup()->getParams(), "_pre");
+    substitutions.addParamSubstitutions(srcNeuronModel->getParamNames(), sg->getSrcNeuronGroup()->getParams(),
+                                        sg->getSrcNeuronGroup()->getRuntimeParams(), sg->getSrcNeuronGroup()->getRuntimeParamsName(), "_pre");
 
     DerivedParamNameIterCtx preDerivedParams(srcNeuronModel->getDerivedParams());
-    value_substitutions(wCode, preDerivedParams.nameBegin, preDerivedParams.nameEnd, sg->getSrcNeuronGroup()->getDerivedParams(), "_pre");
+    substitutions.addParamSubstitutions(preDerivedParams.nameBegin, preDerivedParams.nameEnd, sg->getSrcNeuronGroup()->getDerivedParams(),
+                                        sg->getSrcNeuronGroup()->getRuntimeParams(), sg->getSrcNeuronGroup()->getRuntimeParamsName(), "_pre");
 
     ExtraGlobalParamNameIterCtx preExtraGlobalParams(srcNeuronModel->getExtraGlobalParams());
-    name_substitutions(wCode, "", preExtraGlobalParams.nameBegin, preExtraGlobalParams.nameEnd, sg->getSrcNeuronGroup()->getName(), "_pre");
+    substitutions.addNameSubstitutions("", preExtraGlobalParams.nameBegin, preExtraGlobalParams.nameEnd, sg->getSrcNeuronGroup()->getName(), "_pre");
     
     // postsynaptic neuron variables, parameters, and global parameters
     const auto *trgNeuronModel = sg->getTrgNeuronGroup()->getNeuronModel();
-    substitute(wCode, "$(sT_post)", devPrefix + "sT" + sg->getTrgNeuronGroup()->getName() + "[" + sg->getOffsetPost(devPrefix) + postIdx + "]");
-    for(const auto &v : trgNeuronModel->getVars()) {
-        if (sg->getTrgNeuronGroup()->isVarQueueRequired(v.first)) {
-            substitute(wCode, "$(" + v.first + "_post)",
-                       devPrefix + v.first + sg->getTrgNeuronGroup()->getName() + "[" + sg->getOffsetPost(devPrefix) + postIdx + "]");
+    substitutions.addVarSubstitution("sT_post", devPrefix + "sT" + sg->getTrgNeuronGroup()->getName() + "[" + sg->getOffsetPost(devPrefix) + postIdx + "]");
+    const auto postVars = trgNeuronModel->getVars();
+    for(size_t i = 0; i < postVars.size(); i++) {
+        const auto &v = postVars[i];
+        if (sg->getTrgNeuronGroup()->isVarConstant(v.first)) {
+            substitutions.addVarSubstitution(v.first + "_post", valueToString(sg->getTrgNeuronGroup()->getInitVals()[i]));
+        }
+        else if (sg->getTrgNeuronGroup()->isVarQueueRequired(v.first)) {
+            substitutions.addVarSubstitution(v.first + "_post",
+                                             devPrefix + v.first + sg->getTrgNeuronGroup()->getName() + "[" + sg->getOffsetPost(devPrefix) + postIdx + "]");
         }
         else {
-            substitute(wCode, "$(" + v.first + "_post)",
-                       devPrefix + v.first + sg->getTrgNeuronGroup()->getName() + "[" + postIdx + "]");
+            substitutions.addVarSubstitution(v.first + "_post",
+                                             devPrefix + v.first + sg->getTrgNeuronGroup()->getName() + "[" + postIdx + "]");
         }
     }
-    value_substitutions(wCode, trgNeuronModel->getParamNames(), sg->getTrgNeuronGroup()->getParams(), "_post");
+    substitutions.addParamSubstitutions(trgNeuronModel->getParamNames(), sg->getTrgNeuronGroup()->getParams(),
+                                        sg->getTrgNeuronGroup()->getRuntimeParams(), sg->getTrgNeuronGroup()->getRuntimeParamsName(), "_post");
 
     DerivedParamNameIterCtx postDerivedParams(trgNeuronModel->getDerivedParams());
-    value_substitutions(wCode, postDerivedParams.nameBegin, postDerivedParams.nameEnd, sg->getTrgNeuronGroup()->getDerivedParams(), "_post");
+    substitutions.addParamSubstitutions(postDerivedParams.nameBegin, postDerivedParams.nameEnd, sg->getTrgNeuronGroup()->getDerivedParams(),
+                                        sg->getTrgNeuronGroup()->getRuntimeParams(), sg->getTrgNeuronGroup()->getRuntimeParamsName(), "_post");
 
     ExtraGlobalParamNameIterCtx postExtraGlobalParams(trgNeuronModel->getExtraGlobalParams());
-    name_substitutions(wCode, "", postExtraGlobalParams.nameBegin, postExtraGlobalParams.nameEnd, sg->getTrgNeuronGroup()->getName(), "_post");
+    substitutions.addNameSubstitutions("", postExtraGlobalParams.nameBegin, postExtraGlobalParams.nameEnd, sg->getTrgNeuronGroup()->getName(), "_post");
 }
@@ -33,8 +33,17 @@
 #include "CodeHelper.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
 #include <iterator>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
 
 #ifdef _WIN32
 #include <direct.h>
@@ -42,9 +51,251 @@
 #include <sys/stat.h> // needed for mkdir
 #endif
 
-CodeHelper hlp;
+thread_local CodeHelper hlp;
 //hlp.setVerbose(true);//this will show the generation of bracketing (brace) levels. Helps to debug a bracketing issue
 
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+// 64-bit FNV-1a hash of all code generated so far
+const uint64_t fnvOffsetBasis = 14695981039346656037ULL;
+const uint64_t fnvPrime = 1099511628211ULL;
+
+// Hashes of the generated files, keyed by file name so that the combined hash does not
+// depend on the order in which the generation tasks happen to finish
+map<string, uint64_t> generatedFileHashes;
+string generatedBuildData;
+mutex generatedCodeHashMutex;
+
+//--------------------------------------------------------------------------
+/*! \brief Continue the 64-bit FNV-1a hash hash with data
+ */
+//--------------------------------------------------------------------------
+uint64_t fnvHash(const string &data, uint64_t hash = fnvOffsetBasis)
+{
+    for (char c : data) {
+        hash ^= (unsigned char) c;
+        hash *= fnvPrime;
+    }
+    return hash;
+}
+
+//--------------------------------------------------------------------------
+/*! \brief Queue of code generation tasks shared by the calling thread and a set of worker threads
+ */
+//--------------------------------------------------------------------------
+class GenerationTaskQueue
+{
+public:
+    GenerationTaskQueue() : m_Stop(false){}
+
+    //! Add task to the back of the queue
+    void push(const function<void()> &task)
+    {
+        lock_guard<mutex> lock(m_Mutex);
+        m_Tasks.push_back(task);
+        m_Condition.notify_all();
+    }
+
+    //! Run queued tasks until done returns true or, if done is empty, until stop is called
+    void run(const function<bool()> &done)
+    {
+        unique_lock<mutex> lock(m_Mutex);
+        while (done ? !done() : !m_Stop) {
+            if (m_Tasks.empty()) {
+                m_Condition.wait(lock);
+            }
+            else {
+                const function<void()> task = m_Tasks.front();
+                m_Tasks.pop_front();
+
+                lock.unlock();
+                task();
+                lock.lock();
+
+                // Completing a task may be what a thread waiting for its batch is waiting for
+                m_Condition.notify_all();
+            }
+        }
+    }
+
+    //! Make the threads running the queue without a done condition return once they are idle
+    void stop()
+    {
+        lock_guard<mutex> lock(m_Mutex);
+        m_Stop = true;
+        m_Condition.notify_all();
+    }
+
+private:
+    mutex m_Mutex;
+    condition_variable m_Condition;
+    deque<function<void()>> m_Tasks;
+    bool m_Stop;
+};
+
+// Queue used by the outermost runGenerationTasks call on this thread, so that tasks
+// which themselves call runGenerationTasks share the same pool of threads
+thread_local GenerationTaskQueue *currentTaskQueue = NULL;
+
+//--------------------------------------------------------------------------
+/*! \brief Read the entire contents of a file, returning false if it cannot be opened
+ */
+//--------------------------------------------------------------------------
+bool readFile(const string &name, string &contents)
+{
+    ifstream is(name.c_str(), ios::binary);
+    if (!is.good()) {
+        return false;
+    }
+    stringstream buffer;
+    buffer << is.rdbuf();
+    contents = buffer.str();
+    return true;
+}
+}   // Anonymous namespace
+
+//--------------------------------------------------------------------------
+/*! \brief Open a stream for writing a generated code file.
+ */
+//--------------------------------------------------------------------------
+
+void openGeneratedFile(ofstream &os, const string &name)
+{
+    os.open((name + ".tmp").c_str());
+}
+
+//--------------------------------------------------------------------------
+/*! \brief Close a stream opened with openGeneratedFile, only replacing the existing file if its contents changed.
+ */
+//--------------------------------------------------------------------------
+
+void closeGeneratedFile(ofstream &os, const string &name)
+{
+    os.close();
+
+    const string tmpName = name + ".tmp";
+    string newContents;
+    if (!readFile(tmpName, newContents)) {
+        gennError("Cannot read generated file " + tmpName);
+    }
+    const string fileName = name.substr(name.find_last_of("/\\") + 1);
+    const uint64_t fileHash = fnvHash(newContents, fnvHash(fileName));
+    {
+        lock_guard<mutex> lock(generatedCodeHashMutex);
+        generatedFileHashes[fileName] = fileHash;
+    }
+
+    // If contents are unchanged, keep existing file and its timestamp
+    string oldContents;
+    if (readFile(name, oldContents) && (oldContents == newContents)) {
+        remove(tmpName.c_str());
+    }
+    else {
+        remove(name.c_str());
+        if (rename(tmpName.c_str(), name.c_str()) != 0) {
+            gennError("Cannot write generated file " + name);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+/*! \brief Add a string to the generated code hash
+ */
+//--------------------------------------------------------------------------
+
+void hashGeneratedCode(const string &data)
+{
+    lock_guard<mutex> lock(generatedCodeHashMutex);
+    generatedBuildData += data;
+}
+
+//--------------------------------------------------------------------------
+/*! \brief Get the hash of all code generated by the current generate_model_runner call
+ */
+//--------------------------------------------------------------------------
+
+string getGeneratedCodeHash()
+{
+    lock_guard<mutex> lock(generatedCodeHashMutex);
+    uint64_t generatedCodeHash = fnvOffsetBasis;
+    for (const auto &f : generatedFileHashes) {
+        generatedCodeHash = fnvHash(f.first, generatedCodeHash);
+        for (unsigned int i = 0; i < 8; i++) {
+            generatedCodeHash ^= (f.second >> (8 * i)) & 0xFF;
+            generatedCodeHash *= fnvPrime;
+        }
+    }
+    generatedCodeHash = fnvHash(generatedBuildData, generatedCodeHash);
+
+    char hash[17];
+    snprintf(hash, sizeof(hash), "%016llx", (unsigned long long) generatedCodeHash);
+    return string(hash);
+}
+
+//--------------------------------------------------------------------------
+/*! \brief Run code generation tasks on the pool of code generation threads and wait for them to complete
+ */
+//--------------------------------------------------------------------------
+
+void runGenerationTasks(const vector<function<void()>> &tasks)
+{
+    // each task starts from the brace level of the calling thread
+    const CodeHelper callerHelper = hlp;
+
+    unsigned int numThreads = GENN_PREFERENCES::codeGenerationThreads;
+    if (numThreads == 0) {
+        numThreads = max(1u, thread::hardware_concurrency());
+    }
+    if (numThreads == 1 || tasks.size() < 2) {
+        for (const auto &task : tasks) {
+            hlp = callerHelper;
+            task();
+        }
+        hlp = callerHelper;
+        return;
+    }
+
+    // the outermost call creates the queue and the worker threads which, together
+    // with the calling thread, run all of the tasks queued until it returns
+    GenerationTaskQueue *queue = currentTaskQueue;
+    GenerationTaskQueue ownQueue;
+    vector<thread> workers;
+    if (queue == NULL) {
+        queue = &ownQueue;
+        currentTaskQueue = queue;
+        for (unsigned int i = 1; i < numThreads; i++) {
+            workers.push_back(thread([queue]()
+            {
+                currentTaskQueue = queue;
+                queue->run(function<bool()>());
+            }));
+        }
+    }
+
+    // queue the tasks and help run queued tasks until all of this batch has completed
+    atomic<size_t> numRemaining(tasks.size());
+    for (const auto &task : tasks) {
+        queue->push([&task, &callerHelper, &numRemaining]()
+        {
+            hlp = callerHelper;
+            task();
+            numRemaining--;
+        });
+    }
+    queue->run([&numRemaining](){ return (numRemaining == 0); });
+    hlp = callerHelper;
+
+    if (!workers.empty()) {
+        queue->stop();
+        for (auto &w : workers) {
+            w.join();
+        }
+        currentTaskQueue = NULL;
+    }
+}
 
 //--------------------------------------------------------------------------
 /*! \brief This function will call the necessary sub-functions to generate the code for simulating a model.
@@ -61,31 +312,53 @@ void generate_model_runner(const NNmodel &model,  //!< Model description
   mkdir((path + "/" + model.getName() + "_CODE").c_str(), 0777);
 #endif
 
+  // start a new hash of the generated code
+  generatedFileHashes.clear();
+  generatedBuildData.clear();
+
+  // the files are generated by independent tasks run on the code generation threads
+  vector<function<void()>> tasks;
+
   // general shared code for GPU and CPU versions
-  genRunner(model, path);
+  tasks.push_back([&model, &path](){ genRunner(model, path); });
+  tasks.push_back([&model, &path](){ genInit(model, path); });
 
 #ifndef CPU_ONLY
   // GPU specific code generation
-  genRunnerGPU(model, path);
+  tasks.push_back([&model, &path](){ genRunnerGPU(model, path); });
 
   // generate neuron kernels
-  genNeuronKernel(model, path);
+  tasks.push_back([&model, &path](){ genNeuronKernel(model, path); });
 
   // generate synapse and learning kernels
   if (!model.getSynapseGroups().empty()) {
-      genSynapseKernel(model, path);
+      tasks.push_back([&model, &path](){ genSynapseKernel(model, path); });
   }
 #endif
 
   // Generate the equivalent of neuron kernel
-  genNeuronFunction(model, path);
+  tasks.push_back([&model, &path](){ genNeuronFunction(model, path); });
 
   // Generate the equivalent of synapse and learning kernel
   if (!model.getSynapseGroups().empty()) {
-      genSynapseFunction(model, path);
+      tasks.push_back([&model, &path](){ genSynapseFunction(model, path); });
+  }
+
+  // Generate the C interface exported when the model is built as a shared library
+  if (GENN_PREFERENCES::buildSharedLibrary) {
+#ifdef _WIN32
+      gennError("Building the generated code as a shared library is only supported on UNIX platforms.");
+#else
+      tasks.push_back([&model, &path](){ genSharedLibrary(model, path); });
+#endif
+  }
+  // Report the per-group choices made from the profile of the model
+  if (!model.getProfile().empty()) {
+      tasks.push_back([&model, &path](){ genProfileReport(model, path); });
   }
+  runGenerationTasks(tasks);
 
-  // Generate the Makefile for the generated code
+  // Generate the Makefile for the generated code once the hash of all other files is known
   genMakefile(model, path);
 }
 
@@ -20,6 +20,7 @@
 //--------------------------------------------------------------------------
 
 #include "generateCPU.h"
+#include "generateALL.h"
 #include "global.h"
 #include "utils.h"
 #include "codeGenUtils.h"
@@ -28,7 +29,10 @@
 #include "CodeHelper.h"
 
 #include <algorithm>
+#include <functional>
+#include <map>
 #include <typeinfo>
+#include <vector>
 
 //-------------------------------------------------------------------------
 // Anonymous namespace
@@ -46,7 +50,9 @@ void generate_process_presynaptic_events_code_CPU(
     const string &sgName,
     const SynapseGroup &sg,
     const string &postfix, //!< whether to generate code for true spikes or spike type events
-    const string &ftype)
+    const string &ftype,
+    bool countEvents, //!< whether to generate code counting the events processed and synapses updated
+    unsigned int batchSize) //!< number of instances of the model simulated together
 {
     bool evnt = postfix == "Evnt";
     int UIntSz = sizeof(unsigned int) * 8;
@@ -58,14 +64,33 @@ void generate_process_presynaptic_events_code_CPU(
 
         // Detect spike events or spikes and do the update
         os << "// process presynaptic events: " << (evnt ? "Spike type events" : "True Spikes") << ENDL;
-        if (sg.getSrcNeuronGroup()->isDelayRequired()) {
-            os << "for (int i = 0; i < glbSpkCnt" << postfix << sg.getSrcNeuronGroup()->getName() << "[delaySlot]; i++)" << OB(201);
+
+        // each instance of a batched model has its own spikes so they are propagated one instance at a time
+        string spkCnt = "glbSpkCnt" + postfix + sg.getSrcNeuronGroup()->getName() + (sg.getSrcNeuronGroup()->isDelayRequired() ? "[delaySlot]" : "[0]");
+        string offsetPre = sg.getOffsetPre();
+        string preIdx = "ipre";
+        string postIdx = "ipost";
+        string synIdx = sparse ? "C" + sgName + ".indInG[ipre] + j" : "ipre * " + to_string(sg.getTrgNeuronGroup()->getNumNeurons()) + " + ipost";
+        if (batchSize > 1) {
+            os << "for (unsigned int b = 0; b < " << batchSize << "; b++)" << OB(203);
+            spkCnt = "glbSpkCnt" + postfix + sg.getSrcNeuronGroup()->getName() + "[b]";
+            offsetPre = "(b * " + to_string(sg.getSrcNeuronGroup()->getNumNeurons()) + ") + ";
+            preIdx = "(ipre * " + to_string(batchSize) + ") + b";
+            postIdx = "(ipost * " + to_string(batchSize) + ") + b";
+            synIdx = "((" + synIdx + ") * " + to_string(batchSize) + ") + b";
         }
-        else {
-            os << "for (int i = 0; i < glbSpkCnt" << postfix << sg.getSrcNeuronGroup()->getName() << "[0]; i++)" << OB(201);
+        if (countEvents) {
+            os << "synapseCounters" << sgName << "." << (evnt ? "preSpikeEvents" : "preSpikes") << " += " << spkCnt << ";" << ENDL;
+        }
+        if (sg.getTrgNeuronGroup()->isQuiescenceSkippingEnabled()) {
+            os << "// wake the postsynaptic group up to apply the input" << ENDL;
+            os << "if (" << spkCnt << " > 0)" << OB(2040);
+            os << "quiescent" << sg.getTrgNeuronGroup()->getName() << " = false;" << ENDL;
+            os << CB(2040);
         }
+        os << "for (int i = 0; i < " << spkCnt << "; i++)" << OB(201);
 
-        os << "ipre = glbSpk" << postfix << sg.getSrcNeuronGroup()->getName() << "[" << sg.getOffsetPre() << "i];" << ENDL;
+        os << "ipre = glbSpk" << postfix << sg.getSrcNeuronGroup()->getName() << "[" << offsetPre << "i];" << ENDL;
 
         if (sparse) { // SPARSE
             os << "npost = C" << sgName << ".indInG[ipre + 1] - C" << sgName << ".indInG[ipre];" << ENDL;
@@ -87,7 +112,7 @@ void generate_process_presynaptic_events_code_CPU(
         // Create iteration context to iterate over the variables; derived and extra global parameters
         DerivedParamNameIterCtx wuDerivedParams(wu->getDerivedParams());
         ExtraGlobalParamNameIterCtx wuExtraGlobalParams(wu->getExtraGlobalParams());
-        VarNameIterCtx wuVars(wu->getVars());
+        VarNameIterCtx wuVars(sg.getNonConstantWUVars());
 
         if (evnt) {
             os << "if ";
@@ -101,7 +126,7 @@ void generate_process_presynaptic_events_code_CPU(
             substitute(eCode, "$(t)", "t");
             StandardSubstitutions::weightUpdateThresholdCondition(eCode, sg,
                                                                   wuDerivedParams, wuExtraGlobalParams,
-                                                                  "ipre", "ipost", "", ftype);
+                                                                  preIdx, postIdx, "", ftype);
 
            // end code substitutions ----
             os << "(" << eCode << ")";
@@ -117,29 +142,33 @@ void generate_process_presynaptic_events_code_CPU(
 
         // Code substitutions ----------------------------------------------------------------------------------
         string wCode = evnt ? wu->getEventCode() : wu->getSimCode();
-        substitute(wCode, "$(updatelinsyn)", "$(inSyn) += $(addtoinSyn)");
-        substitute(wCode, "$(t)", "t");
-        if (sparse) { // SPARSE
-            if (sg.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-                name_substitutions(wCode, "", wuVars.nameBegin, wuVars.nameEnd,
-                                   sgName + "[C" + sgName + ".indInG[ipre] + j]");
-            }
-
+        if (sg.isDendriticDelayRequired()) {
+            // delayed input is added to the slot of the ring buffer which the postsynaptic neuron reads after the delay of the synapse
+            const string numTrgNeurons = to_string(sg.getTrgNeuronGroup()->getNumNeurons());
+            substitute(wCode, "$(updatelinsyn)", "denDelay" + sgName + "[(((denDelayPtr" + sgName + " + (unsigned int) $(" + sg.getDendriticDelayVar() + ")) % "
+                       + to_string(sg.getMaxDendriticDelaySteps()) + ") * " + numTrgNeurons + ") + " + postIdx + "] += $(addtoinSyn)");
         }
-        else { // DENSE
-            if (sg.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-                name_substitutions(wCode, "", wuVars.nameBegin, wuVars.nameEnd,
-                                    sgName + "[ipre * " + to_string(sg.getTrgNeuronGroup()->getNumNeurons()) + " + ipost]");
-            }
-
+        else if (sg.isPSLazyDecayEnabled()) {
+            // lazily decayed input is stored divided by the decay of its group since it was last renormalised
+            substitute(wCode, "$(updatelinsyn)", "$(inSyn) += $(addtoinSyn) * inSynInvScale");
+        }
+        else {
+            substitute(wCode, "$(updatelinsyn)", "$(inSyn) += $(addtoinSyn)");
         }
-        substitute(wCode, "$(inSyn)", "inSyn" + sgName + "[ipost]");
+        substitute(wCode, "$(t)", "t");
+        if (sg.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+            name_substitutions(wCode, "", wuVars.nameBegin, wuVars.nameEnd, sgName + "[" + synIdx + "]");
+        }
+        substitute(wCode, "$(inSyn)", "inSyn" + sgName + "[" + postIdx + "]");
 
         StandardSubstitutions::weightUpdateSim(wCode, sg,
                                                wuVars, wuDerivedParams, wuExtraGlobalParams,
-                                               "ipre", "ipost", "", ftype);
+                                               preIdx, postIdx, "", ftype);
         // end Code substitutions -------------------------------------------------------------------------
         os << wCode << ENDL;
+        if (countEvents) {
+            os << "lSynapseUpdates++;" << ENDL;
+        }
 
         if (evnt) {
             os << CB(2041); // end if (eCode)
@@ -149,479 +178,944 @@ void generate_process_presynaptic_events_code_CPU(
         }
         os << CB(202);
         os << CB(201);
+        if (batchSize > 1) {
+            os << CB(203);
+        }
     }
 }
-}   // Anonymous namespace
 
-//--------------------------------------------------------------------------
+//-------------------------------------------------------------------------
 /*!
-  \brief Function that generates the code of the function the will simulate all neurons on the CPU.
+  \brief Function for generating the body of the CPU update function of a neuron group
 */
-//--------------------------------------------------------------------------
-
-void genNeuronFunction(const NNmodel &model, //!< Model description
-                       const string &path) //!< Path for code generation
+//-------------------------------------------------------------------------
+void generateNeuronGroupUpdate(
+    ostream &os, //!< output stream for code
+    const NNmodel &model,
+    const NeuronGroup &ng,
+    const string &numNeurons) //!< expression for the number of neurons to update
 {
-    ofstream os;
+    if (model.isGroupTimingEnabled()) {
+        os << "const auto groupStart = std::chrono::steady_clock::now();" << ENDL;
+    }
 
-    string name = path + "/" + model.getName() + "_CODE/neuronFnct.cc";
-    os.open(name.c_str());
+    // the state of the instances of a batched model is interleaved so the instances of each neuron are updated together
+    const unsigned int batchSize = model.getBatchSize();
+    const string varIdx = (batchSize > 1) ? "nb" : "n";
 
-    // write header content
-    writeHeader(os);
-    os << ENDL;
+    // increment spike queue pointer and reset spike count
+    if (batchSize > 1) {
+        os << "for (unsigned int b = 0; b < " << batchSize << "; b++)" << OB(11);
+        if (ng.isSpikeEventRequired()) {
+            os << "glbSpkCntEvnt" << ng.getName() << "[b] = 0;" << ENDL;
+        }
+        os << "glbSpkCnt" << ng.getName() << "[b] = 0;" << ENDL;
+        os << CB(11);
+    }
+    else {
+        StandardGeneratedSections::neuronOutputInit(os, ng, "");
+    }
 
-    // compiler/include control (include once)
-    os << "#ifndef _" << model.getName() << "_neuronFnct_cc" << ENDL;
-    os << "#define _" << model.getName() << "_neuronFnct_cc" << ENDL;
+    if (ng.isVarQueueRequired() && ng.isDelayRequired()) {
+        os << "unsigned int delaySlot = (spkQuePtr" << ng.getName();
+        os << " + " << (ng.getNumDelaySlots() - 1);
+        os << ") % " << ng.getNumDelaySlots() << ";" << ENDL;
+    }
     os << ENDL;
 
-    // write doxygen comment
-    os << "//-------------------------------------------------------------------------" << ENDL;
-    os << "/*! \\file neuronFnct.cc" << ENDL << ENDL;
-    os << "\\brief File generated from GeNN for the model " << model.getName();
-    os << " containing the the equivalent of neuron kernel function for the CPU-only version." << ENDL;
-    os << "*/" << ENDL;
-    os << "//-------------------------------------------------------------------------" << ENDL << ENDL;
+    // the spike counts are reset above on every time step so spikes are not propagated again in between updates
+    if (ng.getUpdatePeriod() > 1) {
+        os << "// this group is only updated every " << ng.getUpdatePeriod() << " time steps" << ENDL;
+        os << "if ((iT % " << ng.getUpdatePeriod() << ") == 0)" << OB(14);
+    }
 
-    os << "// include the support codes provided by the user for neuron or synaptic models" << ENDL;
-    os << "#include \"support_code.h\"" << ENDL << ENDL; 
+    // the flag is cleared by any neuron which is not at rest and by incoming spikes
+    if (ng.isQuiescenceSkippingEnabled()) {
+        os << "// this group is not updated while all of its neurons are at rest and receive no input" << ENDL;
+        os << "if (!quiescent" << ng.getName() << ")" << OB(15);
+        os << "quiescent" << ng.getName() << " = true;" << ENDL;
+    }
 
-    // function header
-    os << "void calcNeuronsCPU(" << model.getPrecision() << " t)" << ENDL;
-    os << OB(51);
+    os << "for (int n = 0; n < " <<  numNeurons << "; n++)" << OB(10);
+    if (batchSize > 1) {
+        os << "for (unsigned int b = 0; b < " << batchSize << "; b++)" << OB(12);
+        os << "const unsigned int nb = (n * " << batchSize << ") + b;" << ENDL;
+    }
 
-    // function code
-    for(const auto &n : model.getNeuronGroups()) {
-        os << "// neuron group " << n.first << ENDL;
-        os << OB(55);
+    // Get neuron model associated with this group
+    auto nm = ng.getNeuronModel();
 
-        // increment spike queue pointer and reset spike count
-        StandardGeneratedSections::neuronOutputInit(os, n.second, "");
+    // Create iteration context to iterate over the variables; derived and extra global parameters
+    VarNameIterCtx nmVars(nm->getVars());
+    DerivedParamNameIterCtx nmDerivedParams(nm->getDerivedParams());
+    ExtraGlobalParamNameIterCtx nmExtraGlobalParams(nm->getExtraGlobalParams());
 
-        if (n.second.isVarQueueRequired() && n.second.isDelayRequired()) {
-            os << "unsigned int delaySlot = (spkQuePtr" << n.first;
-            os << " + " << (n.second.getNumDelaySlots() - 1);
-            os << ") % " << n.second.getNumDelaySlots() << ";" << ENDL;
+    // Generate code to copy neuron state into local variable
+    StandardGeneratedSections::neuronLocalVarInit(os, ng, nmVars, "", varIdx);
+
+    if ((nm->getSimCode().find("$(sT)") != string::npos)
+        || (nm->getThresholdConditionCode().find("$(sT)") != string::npos)
+        || (nm->getResetCode().find("$(sT)") != string::npos)) { // load sT into local variable
+        os << model.getPrecision() << " lsT= sT" <<  ng.getName() << "[";
+        if (ng.isDelayRequired()) {
+            os << "(delaySlot * " << ng.getNumNeurons() << ") + ";
         }
-        os << ENDL;
+        os << varIdx << "];" << ENDL;
+    }
+    os << ENDL;
 
-        os << "for (int n = 0; n < " <<  n.second.getNumNeurons() << "; n++)" << OB(10);
+    if (ng.getInSyn().size() > 0 || (nm->getSimCode().find("Isyn") != string::npos)) {
+        os << model.getPrecision() << " Isyn = 0;" << ENDL;
+    }
 
-        // Get neuron model associated with this group
-        auto nm = n.second.getNeuronModel();
 
-        // Create iteration context to iterate over the variables; derived and extra global parameters
-        VarNameIterCtx nmVars(nm->getVars());
-        DerivedParamNameIterCtx nmDerivedParams(nm->getDerivedParams());
-        ExtraGlobalParamNameIterCtx nmExtraGlobalParams(nm->getExtraGlobalParams());
-
-        // Generate code to copy neuron state into local variable
-        StandardGeneratedSections::neuronLocalVarInit(os, n.second, nmVars, "", "n");
-
-        if ((nm->getSimCode().find("$(sT)") != string::npos)
-            || (nm->getThresholdConditionCode().find("$(sT)") != string::npos)
-            || (nm->getResetCode().find("$(sT)") != string::npos)) { // load sT into local variable
-            os << model.getPrecision() << " lsT= sT" <<  n.first << "[";
-            if (n.second.isDelayRequired()) {
-                os << "(delaySlot * " << n.second.getNumNeurons() << ") + ";
+    for(const auto *sg : ng.getInSyn()) {
+        const auto *psm = sg->getPSModel();
+
+        if (sg->isDendriticDelayRequired()) {
+            const string denDelay = "denDelay" + sg->getName() + "[(denDelayPtr" + sg->getName() + " * " + numNeurons + ") + " + varIdx + "]";
+            os << "// apply the delayed input arriving on this time step" << ENDL;
+            os << "inSyn" << sg->getName() << "[" << varIdx << "] += " << denDelay << ";" << ENDL;
+            os << denDelay << " = " << model.scalarExpr(0.0) << ";" << ENDL;
+        }
+
+        if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+            for(const auto &v : psm->getVars()) {
+                os << v.second << " lps" << v.first << sg->getName();
+                os << " = " <<  v.first << sg->getName() << "[" << varIdx << "];" << ENDL;
             }
-            os << "n];" << ENDL;
         }
-        os << ENDL;
 
-        if (n.second.getInSyn().size() > 0 || (nm->getSimCode().find("Isyn") != string::npos)) {
-            os << model.getPrecision() << " Isyn = 0;" << ENDL;
+        // Apply substitutions to current converter code
+        string psCode = psm->getCurrentConverterCode();
+        substitute(psCode, "$(id)", "n");
+        if (sg->isPSLazyDecayEnabled()) {
+            substitute(psCode, "$(inSyn)", "(inSyn" + sg->getName() + "[" + varIdx + "] * inSynScale" + sg->getName() + ")");
+        }
+        else {
+            substitute(psCode, "$(inSyn)", "inSyn" + sg->getName() + "[" + varIdx + "]");
         }
+        StandardSubstitutions::postSynapseCurrentConverter(psCode, sg, ng,
+            nmVars, nmDerivedParams, nmExtraGlobalParams, model.getPrecision());
 
+        if (!psm->getSupportCode().empty()) {
+            os << OB(29) << " using namespace " << sg->getName() << "_postsyn;" << ENDL;
+        }
+        os << "Isyn += ";
+        os << psCode << ";" << ENDL;
+        if (!psm->getSupportCode().empty()) {
+            os << CB(29) << " // namespace bracket closed" << ENDL;
+        }
+    }
 
-        for(const auto *sg : n.second.getInSyn()) {
-            const auto *psm = sg->getPSModel();
+    if (!nm->getSupportCode().empty()) {
+        os << " using namespace " << ng.getName() << "_neuron;" << ENDL;
+    }
 
-            if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-                for(const auto &v : psm->getVars()) {
-                    os << v.second << " lps" << v.first << sg->getName();
-                    os << " = " <<  v.first << sg->getName() << "[n];" << ENDL;
-                }
-            }
+    string thCode = nm->getThresholdConditionCode();
+    if (thCode.empty()) { // no condition provided
+        cerr << "Warning: No thresholdConditionCode for neuron type " << typeid(*nm).name() << " used for population \"" << ng.getName() << "\" was provided. There will be no spikes detected in this population!" << endl;
+    }
+    else {
+        os << "// test whether spike condition was fulfilled previously" << ENDL;
+        substitute(thCode, "$(id)", "n");
+        StandardSubstitutions::neuronThresholdCondition(thCode, ng,
+                                                        nmVars, nmDerivedParams, nmExtraGlobalParams,
+                                                        model.getPrecision());
+        if (GENN_PREFERENCES::autoRefractory) {
+            os << "bool oldSpike= (" << thCode << ");" << ENDL;
+        }
+    }
 
-            // Apply substitutions to current converter code
-            string psCode = psm->getCurrentConverterCode();
-            substitute(psCode, "$(id)", "n");
-            substitute(psCode, "$(inSyn)", "inSyn" + sg->getName() + "[n]");
-            StandardSubstitutions::postSynapseCurrentConverter(psCode, sg, n.second,
-                nmVars, nmDerivedParams, nmExtraGlobalParams, model.getPrecision());
+    os << "// calculate membrane potential" << ENDL;
+    string sCode = nm->getSimCode();
+    substitute(sCode, "$(id)", "n");
+    StandardSubstitutions::neuronSim(sCode, ng,
+                                     nmVars, nmDerivedParams, nmExtraGlobalParams,
+                                     model.getPrecision());
+    if (nm->isPoisson()) {
+        substitute(sCode, "lrate", "rates" + ng.getName() + "[n + offset" + ng.getName() + "]");
+    }
+    os << sCode << ENDL;
 
-            if (!psm->getSupportCode().empty()) {
-                os << OB(29) << " using namespace " << sg->getName() << "_postsyn;" << ENDL;
-            }
-            os << "Isyn += ";
-            os << psCode << ";" << ENDL;
-            if (!psm->getSupportCode().empty()) {
-                os << CB(29) << " // namespace bracket closed" << ENDL;
-            }
-        }
+    string queueOffset = ng.getQueueOffset("");
 
-        if (!nm->getSupportCode().empty()) {
-            os << " using namespace " << n.first << "_neuron;" << ENDL;
-        }
+    // look for spike type events first.
+    if (ng.isSpikeEventRequired()) {
+        // Generate spike event test
+        StandardGeneratedSections::neuronSpikeEventTest(os, ng,
+                                                        nmVars, nmExtraGlobalParams,
+                                                        "n", model.getPrecision());
 
-        string thCode = nm->getThresholdConditionCode();
-        if (thCode.empty()) { // no condition provided
-            cerr << "Warning: No thresholdConditionCode for neuron type " << typeid(*nm).name() << " used for population \"" << n.first << "\" was provided. There will be no spikes detected in this population!" << endl;
+        os << "// register a spike-like event" << ENDL;
+        os << "if (spikeLikeEvent)" << OB(30);
+        if (batchSize > 1) { // BATCHED
+            os << "glbSpkEvnt" << ng.getName() << "[(b * " << numNeurons << ") + glbSpkCntEvnt" << ng.getName() << "[b]++] = n;" << ENDL;
         }
-        else {
-            os << "// test whether spike condition was fulfilled previously" << ENDL;
-            substitute(thCode, "$(id)", "n");
-            StandardSubstitutions::neuronThresholdCondition(thCode, n.second,
-                                                            nmVars, nmDerivedParams, nmExtraGlobalParams,
-                                                            model.getPrecision());
-            if (GENN_PREFERENCES::autoRefractory) {
-                os << "bool oldSpike= (" << thCode << ");" << ENDL;
-            }
+        else if (ng.isDelayRequired()) { // WITH DELAY
+            os << "glbSpkEvnt" << ng.getName() << "[" << queueOffset << "glbSpkCntEvnt" << ng.getName();
+            os << "[spkQuePtr" << ng.getName() << "]++] = n;" << ENDL;
         }
-
-        os << "// calculate membrane potential" << ENDL;
-        string sCode = nm->getSimCode();
-        substitute(sCode, "$(id)", "n");
-        StandardSubstitutions::neuronSim(sCode, n.second,
-                                         nmVars, nmDerivedParams, nmExtraGlobalParams,
-                                         model.getPrecision());
-        if (nm->isPoisson()) {
-            substitute(sCode, "lrate", "rates" + n.first + "[n + offset" + n.first + "]");
+        else { // NO DELAY
+            os << "glbSpkEvnt" << ng.getName() << "[" << queueOffset << "glbSpkCntEvnt" << ng.getName();
+            os << "[0]++] = n;" << ENDL;
         }
-        os << sCode << ENDL;
-
-        string queueOffset = n.second.getQueueOffset("");
+        os << CB(30);
+    }
 
-        // look for spike type events first.
-        if (n.second.isSpikeEventRequired()) {
-            // Generate spike event test
-            StandardGeneratedSections::neuronSpikeEventTest(os, n.second,
-                                                            nmVars, nmExtraGlobalParams,
-                                                            "n", model.getPrecision());
+    // test for true spikes if condition is provided
+    if (!thCode.empty()) {
+        os << "// test for and register a true spike" << ENDL;
+        if (GENN_PREFERENCES::autoRefractory) {
+          os << "if ((" << thCode << ") && !(oldSpike))" << OB(40);
+        }
+        else{
+          os << "if (" << thCode << ") " << OB(40);
+        }
 
-            os << "// register a spike-like event" << ENDL;
-            os << "if (spikeLikeEvent)" << OB(30);
-            os << "glbSpkEvnt" << n.first << "[" << queueOffset << "glbSpkCntEvnt" << n.first;
-            if (n.second.isDelayRequired()) { // WITH DELAY
-                os << "[spkQuePtr" << n.first << "]++] = n;" << ENDL;
-            }
-            else { // NO DELAY
-                os << "[0]++] = n;" << ENDL;
-            }
-            os << CB(30);
+        string queueOffsetTrueSpk = ng.isTrueSpikeRequired() ? queueOffset : "";
+        if (batchSize > 1) { // BATCHED
+            os << "glbSpk" << ng.getName() << "[(b * " << numNeurons << ") + glbSpkCnt" << ng.getName() << "[b]++] = n;" << ENDL;
+        }
+        else if (ng.isDelayRequired() && ng.isTrueSpikeRequired()) { // WITH DELAY
+            os << "glbSpk" << ng.getName() << "[" << queueOffsetTrueSpk << "glbSpkCnt" << ng.getName();
+            os << "[spkQuePtr" << ng.getName() << "]++] = n;" << ENDL;
+        }
+        else { // NO DELAY
+            os << "glbSpk" << ng.getName() << "[" << queueOffsetTrueSpk << "glbSpkCnt" << ng.getName();
+            os << "[0]++] = n;" << ENDL;
+        }
+        if (ng.isSpikeTimeRequired()) {
+            os << "sT" << ng.getName() << "[" << queueOffset << varIdx << "] = t;" << ENDL;
         }
 
-        // test for true spikes if condition is provided
-        if (!thCode.empty()) {
-            os << "// test for and register a true spike" << ENDL;
-            if (GENN_PREFERENCES::autoRefractory) {
-              os << "if ((" << thCode << ") && !(oldSpike))" << OB(40);
-            }
-            else{
-              os << "if (" << thCode << ") " << OB(40);
-            }
+        // add after-spike reset if provided
+        if (!nm->getResetCode().empty()) {
+            string rCode = nm->getResetCode();
+            substitute(rCode, "$(id)", "n");
+            StandardSubstitutions::neuronReset(rCode, ng,
+                                               nmVars, nmDerivedParams, nmExtraGlobalParams,
+                                               model.getPrecision());
+            os << "// spike reset code" << ENDL;
+            os << rCode << ENDL;
+        }
+        os << CB(40);
+    }
 
-            string queueOffsetTrueSpk = n.second.isTrueSpikeRequired() ? queueOffset : "";
-            os << "glbSpk" << n.first << "[" << queueOffsetTrueSpk << "glbSpkCnt" << n.first;
-            if (n.second.isDelayRequired() && n.second.isTrueSpikeRequired()) { // WITH DELAY
-                os << "[spkQuePtr" << n.first << "]++] = n;" << ENDL;
-            }
-            else { // NO DELAY
-                os << "[0]++] = n;" << ENDL;
-            }
-            if (n.second.isSpikeTimeRequired()) {
-                os << "sT" << n.first << "[" << queueOffset << "n] = t;" << ENDL;
-            }
+    // store the defined parts of the neuron state into the global state variables V etc
+    StandardGeneratedSections::neuronLocalVarWrite(os, ng, nmVars, "", varIdx);
+
+     for(const auto *sg : ng.getInSyn()) {
+        const auto *psm = sg->getPSModel();
+
+        // lazily decayed input is decayed by scaling its whole group once the neurons are updated
+        string pdCode = sg->isPSLazyDecayEnabled() ? "" : psm->getDecayCode();
+        substitute(pdCode, "$(id)", "n");
+        substitute(pdCode, "$(inSyn)", "inSyn" + sg->getName() + "[" + varIdx + "]");
+        StandardSubstitutions::postSynapseDecay(pdCode, sg, ng,
+                                                nmVars, nmDerivedParams, nmExtraGlobalParams,
+                                                model.getPrecision());
+        os << "// the post-synaptic dynamics" << ENDL;
+        if (!psm->getSupportCode().empty()) {
+            os << OB(29) << " using namespace " << sg->getName() << "_postsyn;" << ENDL;
+        }
+        os << pdCode << ENDL;
+        if (!psm->getSupportCode().empty()) {
+            os << CB(29) << " // namespace bracket closed" << endl;
+        }
+        for (const auto &v : psm->getVars()) {
+            os << v.first << sg->getName() << "[" << varIdx << "]" << " = lps" << v.first << sg->getName() << ";" << ENDL;
+        }
+    }
 
-            // add after-spike reset if provided
-            if (!nm->getResetCode().empty()) {
-                string rCode = nm->getResetCode();
-                substitute(rCode, "$(id)", "n");
-                StandardSubstitutions::neuronReset(rCode, n.second,
+    if (ng.isQuiescenceSkippingEnabled()) {
+        string rCode = nm->getRestConditionCode();
+        substitute(rCode, "$(id)", "n");
+        StandardSubstitutions::neuronRestCondition(rCode, ng,
                                                    nmVars, nmDerivedParams, nmExtraGlobalParams,
                                                    model.getPrecision());
-                os << "// spike reset code" << ENDL;
-                os << rCode << ENDL;
-            }
-            os << CB(40);
+        os << "// the group stays awake while any neuron is away from rest or has input left to apply" << ENDL;
+        os << "if (!(" << rCode << ")";
+        for(const auto *sg : ng.getInSyn()) {
+            os << " || (inSyn" << sg->getName() << "[" << varIdx << "] != 0)";
         }
+        os << ")" << OB(16);
+        os << "quiescent" << ng.getName() << " = false;" << ENDL;
+        os << CB(16);
+    }
+    if (batchSize > 1) {
+        os << CB(12);
+    }
+    os << CB(10);
 
-        // store the defined parts of the neuron state into the global state variables V etc
-        StandardGeneratedSections::neuronLocalVarWrite(os, n.second, nmVars, "", "n");
-
-         for(const auto *sg : n.second.getInSyn()) {
-            const auto *psm = sg->getPSModel();
-
-            string pdCode = psm->getDecayCode();
-            substitute(pdCode, "$(id)", "n");
-            substitute(pdCode, "$(inSyn)", "inSyn" + sg->getName() + "[n]");
-            StandardSubstitutions::postSynapseDecay(pdCode, sg, n.second,
+    for(const auto *sg : ng.getInSyn()) {
+        if (sg->isDendriticDelayRequired()) {
+            os << "denDelayPtr" << sg->getName() << " = (denDelayPtr" << sg->getName() << " + 1) % " << sg->getMaxDendriticDelaySteps() << ";" << ENDL;
+        }
+        if (sg->isPSLazyDecayEnabled()) {
+            const string inSynScale = "inSynScale" + sg->getName();
+            string pdCode = sg->getPSModel()->getDecayCode();
+            substitute(pdCode, "$(inSyn)", inSynScale);
+            StandardSubstitutions::postSynapseDecay(pdCode, sg, ng,
                                                     nmVars, nmDerivedParams, nmExtraGlobalParams,
                                                     model.getPrecision());
-            os << "// the post-synaptic dynamics" << ENDL;
-            if (!psm->getSupportCode().empty()) {
-                os << OB(29) << " using namespace " << sg->getName() << "_postsyn;" << ENDL;
-            }
+            os << "// the lazily decayed post-synaptic dynamics" << ENDL;
             os << pdCode << ENDL;
-            if (!psm->getSupportCode().empty()) {
-                os << CB(29) << " // namespace bracket closed" << endl;
-            }
-            for (const auto &v : psm->getVars()) {
-                os << v.first << sg->getName() << "[n]" << " = lps" << v.first << sg->getName() << ";" << ENDL;
+
+            // fold the scale back into the input before the input added to it becomes too large
+            os << "if (" << inSynScale << " < " << ((model.getPrecision() == "float") ? "1e-10f" : "1e-10") << ")" << OB(17);
+            os << "for (int i = 0; i < " << numNeurons;
+            if (batchSize > 1) {
+                os << " * " << batchSize;
             }
+            os << "; i++)" << OB(18);
+            os << "inSyn" << sg->getName() << "[i] *= " << inSynScale << ";" << ENDL;
+            os << CB(18);
+            os << inSynScale << " = " << model.scalarExpr(1.0) << ";" << ENDL;
+            os << CB(17);
         }
-        os << CB(10);
-        os << CB(55);
-        os << ENDL;
     }
-    os << CB(51) << ENDL;
-    os << "#endif" << ENDL;
-    os.close();
-} 
+    if (ng.isQuiescenceSkippingEnabled()) {
+        os << CB(15);
+    }
+    if (ng.getUpdatePeriod() > 1) {
+        os << CB(14);
+    }
+    if (model.isEventCountingEnabled() && batchSize > 1) {
+        os << "for (unsigned int b = 0; b < " << batchSize << "; b++)" << OB(13);
+        os << "neuronCounters" << ng.getName() << ".spikes += glbSpkCnt" << ng.getName() << "[b];" << ENDL;
+        if (ng.isSpikeEventRequired()) {
+            os << "neuronCounters" << ng.getName() << ".spikeEvents += glbSpkCntEvnt" << ng.getName() << "[b];" << ENDL;
+        }
+        os << CB(13);
+    }
+    else if (model.isEventCountingEnabled()) {
+        os << "neuronCounters" << ng.getName() << ".spikes += glbSpkCnt" << ng.getName();
+        os << ((ng.isDelayRequired() && ng.isTrueSpikeRequired()) ? "[spkQuePtr" + ng.getName() + "]" : "[0]") << ";" << ENDL;
+        if (ng.isSpikeEventRequired()) {
+            os << "neuronCounters" << ng.getName() << ".spikeEvents += glbSpkCntEvnt" << ng.getName();
+            os << (ng.isDelayRequired() ? "[spkQuePtr" + ng.getName() + "]" : "[0]") << ";" << ENDL;
+        }
+    }
+    if (model.isGroupTimingEnabled()) {
+        os << "neuronTiming" << ng.getName() << ".add(std::chrono::steady_clock::now() - groupStart);" << ENDL;
+    }
+}
 
-//--------------------------------------------------------------------------
+//-------------------------------------------------------------------------
 /*!
-  \brief Function that generates code that will simulate all synapses of the model on the CPU.
+  \brief Function for listing the types and names of the global variables referred to by the CPU update of a neuron group
 */
-//--------------------------------------------------------------------------
-
-void genSynapseFunction(const NNmodel &model, //!< Model description
-                        const string &path) //!< Path for code generation
+//-------------------------------------------------------------------------
+vector<pair<string, string>> getNeuronGroupUpdateSymbols(
+    const NNmodel &model,
+    const NeuronGroup &ng)
 {
-    ofstream os;
-
-//    cout << "entering genSynapseFunction" << endl;
-    string name = path + "/" + model.getName() + "_CODE/synapseFnct.cc";
-    os.open(name.c_str());
+    vector<pair<string, string>> symbols;
+    symbols.emplace_back("unsigned int *", "glbSpkCnt" + ng.getName());
+    symbols.emplace_back("unsigned int *", "glbSpk" + ng.getName());
+    if (ng.isSpikeEventRequired()) {
+        symbols.emplace_back("unsigned int *", "glbSpkCntEvnt" + ng.getName());
+        symbols.emplace_back("unsigned int *", "glbSpkEvnt" + ng.getName());
+    }
+    if (ng.isDelayRequired()) {
+        symbols.emplace_back("unsigned int", "spkQuePtr" + ng.getName());
+    }
+    if (ng.isQuiescenceSkippingEnabled()) {
+        symbols.emplace_back("bool", "quiescent" + ng.getName());
+    }
+    if (ng.isSpikeTimeRequired()) {
+        symbols.emplace_back(model.getPrecision() + " *", "sT" + ng.getName());
+    }
+    for(const auto &v : ng.getNonConstantVars()) {
+        symbols.emplace_back(v.second + " *", v.first + ng.getName());
+    }
+    for(const auto &e : ng.getNeuronModel()->getExtraGlobalParams()) {
+        symbols.emplace_back(e.second, e.first + ng.getName());
+    }
+    for(const auto *sg : ng.getInSyn()) {
+        symbols.emplace_back(model.getPrecision() + " *", "inSyn" + sg->getName());
+        if (sg->isPSLazyDecayEnabled()) {
+            symbols.emplace_back(model.getPrecision(), "inSynScale" + sg->getName());
+        }
+        if (sg->isDendriticDelayRequired()) {
+            symbols.emplace_back(model.getPrecision() + " *", "denDelay" + sg->getName());
+            symbols.emplace_back("unsigned int", "denDelayPtr" + sg->getName());
+        }
+        if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+            for(const auto &v : sg->getPSModel()->getVars()) {
+                symbols.emplace_back(v.second + " *", v.first + sg->getName());
+            }
+        }
+    }
+    if (model.isEventCountingEnabled()) {
+        symbols.emplace_back("NeuronGroupCounters", "neuronCounters" + ng.getName());
+    }
+    if (model.isGroupTimingEnabled()) {
+        symbols.emplace_back("GroupTimingStats", "neuronTiming" + ng.getName());
+    }
+    return symbols;
+}
 
+//-------------------------------------------------------------------------
+/*!
+  \brief Function for writing the start of a generated CPU source file which is compiled as its own translation unit
+*/
+//-------------------------------------------------------------------------
+void writeCPUSourcePreamble(
+    ostream &os, //!< output stream for code
+    const NNmodel &model,
+    const string &fileName, //!< name of the generated file
+    const string &contents) //!< description of the file contents for the doxygen comment
+{
     // write header content
     writeHeader(os);
     os << ENDL;
 
-    // compiler/include control (include once)
-    os << "#ifndef _" << model.getName() << "_synapseFnct_cc" << ENDL;
-    os << "#define _" << model.getName() << "_synapseFnct_cc" << ENDL;
-    os << ENDL;
-
     // write doxygen comment
     os << "//-------------------------------------------------------------------------" << ENDL;
-    os << "/*! \\file synapseFnct.cc" << ENDL << ENDL;
-    os << "\\brief File generated from GeNN for the model " << model.getName() << " containing the equivalent of the synapse kernel and learning kernel functions for the CPU only version." << ENDL;
+    os << "/*! \\file " << fileName << ENDL << ENDL;
+    os << "\\brief File generated from GeNN for the model " << model.getName() << " containing " << contents << ENDL;
     os << "*/" << ENDL;
     os << "//-------------------------------------------------------------------------" << ENDL << ENDL;
 
-    // synapse dynamics function
-    os << "void calcSynapseDynamicsCPU(" << model.getPrecision() << " t)" << ENDL;
-    os << OB(1000);
-    os << "// execute internal synapse dynamics if any" << ENDL;
-
-    for(const auto &s : model.getSynapseDynamicsGroups())
-    {
-        const SynapseGroup *sg = model.findSynapseGroup(s.first);
-        const auto *wu = sg->getWUModel();
+    os << "#include \"definitions.h\"" << ENDL;
+    os << "#include <cstdlib>" << ENDL;
+    os << "#include <cstdio>" << ENDL;
+    os << "#include <cmath>" << ENDL;
+    os << "#include <ctime>" << ENDL;
+    os << "#include <cassert>" << ENDL;
+    os << "#include <stdint.h>" << ENDL << ENDL;
 
-        // there is some internal synapse dynamics
-        if (!wu->getSynapseDynamicsCode().empty()) {
+    os << "// include the support codes provided by the user for neuron or synaptic models" << ENDL;
+    os << "#include \"support_code.h\"" << ENDL << ENDL;
+}
+//--------------------------------------------------------------------------
+//! \brief Generate the CPU synapse dynamics function of a synapse group with synapse dynamics code
+//--------------------------------------------------------------------------
+void generateSynapseDynamicsFunction(ofstream &os, const NNmodel &model, const string &sgName, const SynapseGroup *sg)
+{
+    const auto *wu = sg->getWUModel();
+
+    // there is some internal synapse dynamics
+    if (!wu->getSynapseDynamicsCode().empty()) {
+        os << "void calcSynapseDynamicsCPU" << sgName << "(" << model.getPrecision() << " t)" << ENDL;
+        os << OB(1005);
+        if (sg->getUpdatePeriod() > 1) {
+            os << "// the synapse dynamics of this group only run every " << sg->getUpdatePeriod() << " time steps" << ENDL;
+            os << "if ((iT % " << sg->getUpdatePeriod() << ") != 0)" << OB(1007);
+            os << "return;" << ENDL;
+            os << CB(1007);
+        }
+        if (model.isGroupTimingEnabled()) {
+            os << "const auto groupStart = std::chrono::steady_clock::now();" << ENDL;
+        }
 
-            os << "// synapse group " << s.first << ENDL;
-            os << OB(1005);
+        if (sg->getSrcNeuronGroup()->isDelayRequired()) {
+            os << "unsigned int delaySlot = (spkQuePtr" << sg->getSrcNeuronGroup()->getName();
+            os << " + " << (sg->getSrcNeuronGroup()->getNumDelaySlots() - sg->getDelaySteps());
+            os << ") % " << sg->getSrcNeuronGroup()->getNumDelaySlots() << ";" << ENDL;
+        }
 
-            if (sg->getSrcNeuronGroup()->isDelayRequired()) {
-                os << "unsigned int delaySlot = (spkQuePtr" << sg->getSrcNeuronGroup()->getName();
-                os << " + " << (sg->getSrcNeuronGroup()->getNumDelaySlots() - sg->getDelaySteps());
-                os << ") % " << sg->getSrcNeuronGroup()->getNumDelaySlots() << ";" << ENDL;
-            }
+        if (!wu->getSynapseDynamicsSuppportCode().empty()) {
+            os << "using namespace " << sgName << "_weightupdate_synapseDynamics;" << ENDL;
+        }
 
-            if (!wu->getSynapseDynamicsSuppportCode().empty()) {
-                os << "using namespace " << s.first << "_weightupdate_synapseDynamics;" << ENDL;
-            }
+        // synapse dynamics which may change the input to or the state of the postsynaptic neurons keep them awake
+        const string &sdCode = wu->getSynapseDynamicsCode();
+        if (sg->getTrgNeuronGroup()->isQuiescenceSkippingEnabled()
+            && ((sdCode.find("inSyn") != string::npos) || (sdCode.find("updatelinsyn") != string::npos)
+                || (sdCode.find("_post)") != string::npos)))
+        {
+            os << "quiescent" << sg->getTrgNeuronGroup()->getName() << " = false;" << ENDL;
+        }
 
-            // Create iteration context to iterate over the variables and derived parameters
-            DerivedParamNameIterCtx wuDerivedParams(wu->getDerivedParams());
-            VarNameIterCtx wuVars(wu->getVars());
-
-            string SDcode= wu->getSynapseDynamicsCode();
-            substitute(SDcode, "$(t)", "t");
-            if (sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) { // SPARSE
-                os << "for (int n= 0; n < C" << s.first << ".connN; n++)" << OB(24) << ENDL;
-                if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-                    // name substitute synapse var names in synapseDynamics code
-                    name_substitutions(SDcode, "", wuVars.nameBegin, wuVars.nameEnd, s.first + "[n]");
-                }
+        // Create iteration context to iterate over the variables and derived parameters
+        DerivedParamNameIterCtx wuDerivedParams(wu->getDerivedParams());
+        VarNameIterCtx wuVars(sg->getNonConstantWUVars());
 
-                StandardSubstitutions::weightUpdateDynamics(SDcode, sg, wuVars, wuDerivedParams,
-                                                            "C" + s.first + ".preInd[n]",
-                                                            "C" + s.first + ".ind[n]",
-                                                            "", model.getPrecision());
-                os << SDcode << ENDL;
-                os << CB(24);
+        string SDcode= wu->getSynapseDynamicsCode();
+        substitute(SDcode, "$(t)", "t");
+        if (sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) { // SPARSE
+            if (model.isEventCountingEnabled()) {
+                os << "synapseCounters" << sgName << ".synDynUpdates += C" << sgName << ".connN;" << ENDL;
+            }
+            os << "for (int n= 0; n < C" << sgName << ".connN; n++)" << OB(24) << ENDL;
+            if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+                // name substitute synapse var names in synapseDynamics code
+                name_substitutions(SDcode, "", wuVars.nameBegin, wuVars.nameEnd, sgName + "[n]");
             }
-            else { // DENSE
-                os << "for (int i = 0; i < " <<  sg->getSrcNeuronGroup()->getNumNeurons() << "; i++)" << OB(25);
-                os << "for (int j = 0; j < " <<  sg->getTrgNeuronGroup()->getNumNeurons() << "; j++)" << OB(26);
-                os << "// loop through all synapses" << endl;
-                // substitute initial values as constants for synapse var names in synapseDynamics code
-                if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-                    name_substitutions(SDcode, "", wuVars.nameBegin, wuVars.nameEnd,
-                                       s.first + "[i*" + to_string(sg->getTrgNeuronGroup()->getNumNeurons()) + "+j]");
-                }
 
-                StandardSubstitutions::weightUpdateDynamics(SDcode, sg, wuVars, wuDerivedParams,
-                                                            "i","j", "", model.getPrecision());
-                os << SDcode << ENDL;
-                os << CB(26);
-                os << CB(25);
+            StandardSubstitutions::weightUpdateDynamics(SDcode, sg, wuVars, wuDerivedParams,
+                                                        "C" + sgName + ".preInd[n]",
+                                                        "C" + sgName + ".ind[n]",
+                                                        "", model.getPrecision());
+            os << SDcode << ENDL;
+            os << CB(24);
+        }
+        else { // DENSE
+            if (model.isEventCountingEnabled()) {
+                os << "synapseCounters" << sgName << ".synDynUpdates += " << sg->getSrcNeuronGroup()->getNumNeurons() * sg->getTrgNeuronGroup()->getNumNeurons() << "ULL;" << ENDL;
+            }
+            os << "for (int i = 0; i < " <<  sg->getSrcNeuronGroup()->getNumNeurons() << "; i++)" << OB(25);
+            os << "for (int j = 0; j < " <<  sg->getTrgNeuronGroup()->getNumNeurons() << "; j++)" << OB(26);
+            os << "// loop through all synapses" << endl;
+            // substitute initial values as constants for synapse var names in synapseDynamics code
+            if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+                name_substitutions(SDcode, "", wuVars.nameBegin, wuVars.nameEnd,
+                                   sgName + "[i*" + to_string(sg->getTrgNeuronGroup()->getNumNeurons()) + "+j]");
             }
-            os << CB(1005);
+
+            StandardSubstitutions::weightUpdateDynamics(SDcode, sg, wuVars, wuDerivedParams,
+                                                        "i","j", "", model.getPrecision());
+            os << SDcode << ENDL;
+            os << CB(26);
+            os << CB(25);
+        }
+        if (model.isGroupTimingEnabled()) {
+            os << "synDynTiming" << sgName << ".add(std::chrono::steady_clock::now() - groupStart);" << ENDL;
         }
+        os << CB(1005);
+        os << ENDL;
     }
-    os << CB(1000);
-
-    // synapse function header
-    os << "void calcSynapsesCPU(" << model.getPrecision() << " t)" << ENDL;
+}
 
-    // synapse function code
-    os << OB(1001);
+//--------------------------------------------------------------------------
+//! \brief Generate the CPU function processing the presynaptic spikes and spike-like events of a synapse group
+//--------------------------------------------------------------------------
+void generateSynapseUpdateFunction(ofstream &os, const NNmodel &model, const string &sgName, const SynapseGroup *sg)
+{
+    os << "void calcSynapsesCPU" << sgName << "(" << model.getPrecision() << " t)" << ENDL;
+    os << OB(1006);
 
     os << "unsigned int ipost;" << ENDL;
     os << "unsigned int ipre;" << ENDL;
-    for(const auto &s : model.getSynapseGroups()) {
-        if (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-            os << "unsigned int npost;" << ENDL;
-            break;
-        }
+    if (sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+        os << "unsigned int npost;" << ENDL;
     }
     os << model.getPrecision() << " addtoinSyn;" << ENDL;
+    if (sg->isPSLazyDecayEnabled()) {
+        os << "const " << model.getPrecision() << " inSynInvScale = " << model.scalarExpr(1.0) << " / inSynScale" << sgName << ";" << ENDL;
+    }
     os << ENDL;
 
-   for(const auto &s : model.getSynapseGroups()) {
-        os << "// synapse group " << s.first << ENDL;
-        os << OB(1006);
+    if (model.isGroupTimingEnabled()) {
+        os << "const auto groupStart = std::chrono::steady_clock::now();" << ENDL;
+    }
 
-        if (s.second.getSrcNeuronGroup()->isDelayRequired()) {
-            os << "unsigned int delaySlot = (spkQuePtr" << s.second.getSrcNeuronGroup()->getName();
-            os << " + " << (s.second.getSrcNeuronGroup()->getNumDelaySlots() - s.second.getDelaySteps());
-            os << ") % " << s.second.getSrcNeuronGroup()->getNumDelaySlots() << ";" << ENDL;
-        }
+    if (sg->getSrcNeuronGroup()->isDelayRequired()) {
+        os << "unsigned int delaySlot = (spkQuePtr" << sg->getSrcNeuronGroup()->getName();
+        os << " + " << (sg->getSrcNeuronGroup()->getNumDelaySlots() - sg->getDelaySteps());
+        os << ") % " << sg->getSrcNeuronGroup()->getNumDelaySlots() << ";" << ENDL;
+    }
 
-        // generate the code for processing spike-like events
-        if (s.second.isSpikeEventRequired()) {
-            generate_process_presynaptic_events_code_CPU(os, s.first, s.second, "Evnt", model.getPrecision());
-        }
+    if (model.isEventCountingEnabled()) {
+        os << "unsigned long long lSynapseUpdates = 0;" << ENDL;
+    }
 
-        // generate the code for processing true spike events
-        if (s.second.isTrueSpikeRequired()) {
-            generate_process_presynaptic_events_code_CPU(os, s.first, s.second, "", model.getPrecision());
-        }
+    // generate the code for processing spike-like events
+    if (sg->isSpikeEventRequired()) {
+        generate_process_presynaptic_events_code_CPU(os, sgName, *sg, "Evnt", model.getPrecision(),
+                                                     model.isEventCountingEnabled(), model.getBatchSize());
+    }
 
-        os << CB(1006);
-        os << ENDL;
+    // generate the code for processing true spike events
+    if (sg->isTrueSpikeRequired()) {
+        generate_process_presynaptic_events_code_CPU(os, sgName, *sg, "", model.getPrecision(),
+                                                     model.isEventCountingEnabled(), model.getBatchSize());
     }
-    os << CB(1001);
+
+    if (model.isEventCountingEnabled()) {
+        os << "synapseCounters" << sgName << ".synapseUpdates += lSynapseUpdates;" << ENDL;
+    }
+
+    if (model.isGroupTimingEnabled()) {
+        os << "synapseTiming" << sgName << ".add(std::chrono::steady_clock::now() - groupStart);" << ENDL;
+    }
+    os << CB(1006);
     os << ENDL;
+}
 
+//--------------------------------------------------------------------------
+//! \brief Generate the CPU function processing the postsynaptic spikes of a synapse group with postsynaptic learning
+//--------------------------------------------------------------------------
+void generatePostLearnFunction(ofstream &os, const NNmodel &model, const string &sgName, const SynapseGroup *sg)
+{
+    const auto *wu = sg->getWUModel();
+    const bool sparse = sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE;
 
-    //////////////////////////////////////////////////////////////
-    // function for learning synapses, post-synaptic spikes
 
-    if (!model.getSynapsePostLearnGroups().empty()) {
+    // Create iteration context to iterate over the variables; derived and extra global parameters
+    DerivedParamNameIterCtx wuDerivedParams(wu->getDerivedParams());
+    ExtraGlobalParamNameIterCtx wuExtraGlobalParams(wu->getExtraGlobalParams());
+    VarNameIterCtx wuVars(sg->getNonConstantWUVars());
 
-        os << "void learnSynapsesPostHost(" << model.getPrecision() << " t)" << ENDL;
-        os << OB(811);
+// NOTE: WE DO NOT USE THE AXONAL DELAY FOR BACKWARDS PROPAGATION - WE CAN TALK ABOUT BACKWARDS DELAYS IF WE WANT THEM
 
-        os << "unsigned int ipost;" << ENDL;
-        os << "unsigned int ipre;" << ENDL;
-        os << "unsigned int lSpk;" << ENDL;
+    os << "void learnSynapsesPostHost" << sgName << "(" << model.getPrecision() << " t)" << ENDL;
+    os << OB(950);
 
-        // If any synapse groups have sparse connectivity
-        if(any_of(begin(model.getSynapseGroups()), end(model.getSynapseGroups()),
-            [](const std::pair<string, SynapseGroup> &s)
-            {
-                return (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE);
+    os << "unsigned int ipost;" << ENDL;
+    os << "unsigned int ipre;" << ENDL;
+    os << "unsigned int lSpk;" << ENDL;
+    if (sparse) {
+        os << "unsigned int npre;" << ENDL;
+    }
+    os << ENDL;
 
-            }))
-        {
-            os << "unsigned int npre;" << ENDL;
-        }
-        os << ENDL;
+    if (model.isGroupTimingEnabled()) {
+        os << "const auto groupStart = std::chrono::steady_clock::now();" << ENDL;
+    }
 
-        for(const auto &s : model.getSynapsePostLearnGroups())
-        {
-            const SynapseGroup *sg = model.findSynapseGroup(s.first);
-            const auto *wu = sg->getWUModel();
-            const bool sparse = sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE;
+    if (sg->getSrcNeuronGroup()->isDelayRequired()) {
+        os << "unsigned int delaySlot = (spkQuePtr" << sg->getSrcNeuronGroup()->getName();
+        os << " + " << (sg->getSrcNeuronGroup()->getNumDelaySlots() - sg->getDelaySteps());
+        os << ") % " << sg->getSrcNeuronGroup()->getNumDelaySlots() << ";" << ENDL;
+    }
 
-            // Create iteration context to iterate over the variables; derived and extra global parameters
-            DerivedParamNameIterCtx wuDerivedParams(wu->getDerivedParams());
-            ExtraGlobalParamNameIterCtx wuExtraGlobalParams(wu->getExtraGlobalParams());
-            VarNameIterCtx wuVars(wu->getVars());
+    if (!wu->getLearnPostSupportCode().empty()) {
+        os << "using namespace " << sgName << "_weightupdate_simLearnPost;" << ENDL;
+    }
+    if (model.isEventCountingEnabled()) {
+        os << "unsigned long long lPostLearnUpdates = 0;" << ENDL;
+    }
 
-// NOTE: WE DO NOT USE THE AXONAL DELAY FOR BACKWARDS PROPAGATION - WE CAN TALK ABOUT BACKWARDS DELAYS IF WE WANT THEM
+    if (sg->getTrgNeuronGroup()->isDelayRequired() && sg->getTrgNeuronGroup()->isTrueSpikeRequired()) {
+        os << "for (ipost = 0; ipost < glbSpkCnt" << sg->getTrgNeuronGroup()->getName() << "[spkQuePtr" << sg->getTrgNeuronGroup()->getName() << "]; ipost++)" << OB(910);
+    }
+    else {
+        os << "for (ipost = 0; ipost < glbSpkCnt" << sg->getTrgNeuronGroup()->getName() << "[0]; ipost++)" << OB(910);
+    }
 
-            os << "// synapse group " << s.first << ENDL;
-            os << OB(950);
+    string offsetTrueSpkPost = sg->getTrgNeuronGroup()->isTrueSpikeRequired() ? sg->getOffsetPost("") : "";
+    os << "lSpk = glbSpk" << sg->getTrgNeuronGroup()->getName() << "[" << offsetTrueSpkPost << "ipost];" << ENDL;
 
-            if (sg->getSrcNeuronGroup()->isDelayRequired()) {
-                os << "unsigned int delaySlot = (spkQuePtr" << sg->getSrcNeuronGroup()->getName();
-                os << " + " << (sg->getSrcNeuronGroup()->getNumDelaySlots() - sg->getDelaySteps());
-                os << ") % " << sg->getSrcNeuronGroup()->getNumDelaySlots() << ";" << ENDL;
-            }
+    if (sparse) { // SPARSE
+        // TODO: THIS NEEDS CHECKING AND FUNCTIONAL C.POST* ARRAYS
+        os << "npre = C" << sgName << ".revIndInG[lSpk + 1] - C" << sgName << ".revIndInG[lSpk];" << ENDL;
+        os << "for (int l = 0; l < npre; l++)" << OB(121);
+        os << "ipre = C" << sgName << ".revIndInG[lSpk] + l;" << ENDL;
+    }
+    else { // DENSE
+        os << "for (ipre = 0; ipre < " << sg->getSrcNeuronGroup()->getNumNeurons() << "; ipre++)" << OB(121);
+    }
+
+    string code = wu->getLearnPostCode();
+    substitute(code, "$(t)", "t");
+    // Code substitutions ----------------------------------------------------------------------------------
+    if (sparse) { // SPARSE
+        name_substitutions(code, "", wuVars.nameBegin, wuVars.nameEnd,
+                           sgName + "[C" + sgName + ".remap[ipre]]");
+    }
+    else { // DENSE
+        name_substitutions(code, "", wuVars.nameBegin, wuVars.nameEnd,
+                           sgName + "[lSpk + " + to_string(sg->getTrgNeuronGroup()->getNumNeurons()) + " * ipre]");
+    }
+    StandardSubstitutions::weightUpdatePostLearn(code, sg,
+                                                 wuDerivedParams, wuExtraGlobalParams,
+                                                 sparse ?  "C" + sgName + ".revInd[ipre]" : "ipre",
+                                                 "lSpk", "", model.getPrecision());
+    // end Code substitutions -------------------------------------------------------------------------
+    os << code << ENDL;
+    if (model.isEventCountingEnabled()) {
+        os << "lPostLearnUpdates++;" << ENDL;
+    }
+
+    os << CB(121);
+    os << CB(910);
+    if (model.isEventCountingEnabled()) {
+        os << "synapseCounters" << sgName << ".postLearnUpdates += lPostLearnUpdates;" << ENDL;
+    }
+    if (model.isGroupTimingEnabled()) {
+        os << "learningTiming" << sgName << ".add(std::chrono::steady_clock::now() - groupStart);" << ENDL;
+    }
+    os << CB(950);
+    os << ENDL;
+}
+}   // Anonymous namespace
+
+//--------------------------------------------------------------------------
+/*!
+  \brief Function that generates the code of the function the will simulate all neurons on the CPU.
+*/
+//--------------------------------------------------------------------------
 
-            if (!wu->getLearnPostSupportCode().empty()) {
-                os << "using namespace " << s.first << "_weightupdate_simLearnPost;" << ENDL;
+void genNeuronFunction(const NNmodel &model, //!< Model description
+                       const string &path) //!< Path for code generation
+{
+    // the neuron groups whose updates are merged
+    const auto &mergedNeuronGroups = model.getMergedNeuronGroups();
+    map<string, size_t> mergedNeuronGroupIndices;
+    for(size_t i = 0; i < mergedNeuronGroups.size(); i++) {
+        for(const auto &name : mergedNeuronGroups[i]) {
+            mergedNeuronGroupIndices[name] = i;
+        }
+    }
+
+    // the update of each neuron group is generated as a separate translation unit
+    vector<function<void()>> tasks;
+    for(const auto &n : model.getNeuronGroups()) {
+        if (mergedNeuronGroupIndices.find(n.first) != mergedNeuronGroupIndices.end()) {
+            continue;
+        }
+        tasks.push_back([&model, &path, &n]()
+        {
+            ofstream os;
+
+            const string groupFileName = "neuronFnct" + n.first + ".cc";
+            const string groupName = path + "/" + model.getName() + "_CODE/" + groupFileName;
+            openGeneratedFile(os, groupName);
+            writeCPUSourcePreamble(os, model, groupFileName,
+                                   "the equivalent of the neuron kernel code for neuron group " + n.first + " for the CPU-only version.");
+
+            os << "void calcNeuronsCPU" << n.first << "(" << model.getPrecision() << " t)" << ENDL;
+            os << OB(55);
+            generateNeuronGroupUpdate(os, model, n.second, to_string(n.second.getNumNeurons()));
+            os << CB(55);
+            closeGeneratedFile(os, groupName);
+        });
+    }
+
+    // the updates of each set of merged neuron groups are generated from the first group of the set as a
+    // single loop over a table holding the addresses of each group's globals and its differing parameters
+    for(size_t i = 0; i < mergedNeuronGroups.size(); i++) {
+        tasks.push_back([&model, &path, &mergedNeuronGroups, i]()
+        {
+            ofstream os;
+
+            const NeuronGroup &archetype = *model.findNeuronGroup(mergedNeuronGroups[i].front());
+            const string mergedName = "Merged" + to_string(i);
+            const string groupFileName = "neuronFnct" + mergedName + ".cc";
+            const string groupName = path + "/" + model.getName() + "_CODE/" + groupFileName;
+            openGeneratedFile(os, groupName);
+            writeCPUSourcePreamble(os, model, groupFileName,
+                                   "the equivalent of the neuron kernel code for the merged neuron groups " + to_string(i) + " for the CPU-only version.");
+
+            // parameters and derived parameters which differ between the groups
+            const auto *nm = archetype.getNeuronModel();
+            const auto paramNames = nm->getParamNames();
+            DerivedParamNameIterCtx nmDerivedParams(nm->getDerivedParams());
+            vector<string> heterogeneousParamNames;
+            for(size_t p = 0; p < paramNames.size(); p++) {
+                if (archetype.isParamHeterogeneous(p)) {
+                    heterogeneousParamNames.push_back(paramNames[p]);
+                }
+            }
+            size_t dp = 0;
+            for(auto d = nmDerivedParams.nameBegin; d != nmDerivedParams.nameEnd; d++, dp++) {
+                if (archetype.isDerivedParamHeterogeneous(dp)) {
+                    heterogeneousParamNames.push_back(*d);
+                }
             }
 
-            if (sg->getTrgNeuronGroup()->isDelayRequired() && sg->getTrgNeuronGroup()->isTrueSpikeRequired()) {
-                os << "for (ipost = 0; ipost < glbSpkCnt" << sg->getTrgNeuronGroup()->getName() << "[spkQuePtr" << sg->getTrgNeuronGroup()->getName() << "]; ipost++)" << OB(910);
+            // table entry type - globals are named after those of the first group
+            const auto symbols = getNeuronGroupUpdateSymbols(model, archetype);
+            os << "struct MergedNeuronGroup" << i << ENDL;
+            os << "{" << ENDL;
+            os << "    unsigned int numNeurons;" << ENDL;
+            for(const auto &sym : symbols) {
+                os << "    " << sym.first << " *" << sym.second << ";" << ENDL;
+            }
+            for(const auto &param : heterogeneousParamNames) {
+                os << "    " << model.getPrecision() << " " << param << ";" << ENDL;
             }
-            else {
-                os << "for (ipost = 0; ipost < glbSpkCnt" << sg->getTrgNeuronGroup()->getName() << "[0]; ipost++)" << OB(910);
+            os << "};" << ENDL << ENDL;
+
+            os << "MergedNeuronGroup" << i << " mergedNeuronGroup" << i << "[] =" << ENDL;
+            os << "{" << ENDL;
+            for(const auto &name : mergedNeuronGroups[i]) {
+                const NeuronGroup &ng = *model.findNeuronGroup(name);
+                os << "    {" << ng.getNumNeurons();
+                for(const auto &sym : getNeuronGroupUpdateSymbols(model, ng)) {
+                    os << ", &" << sym.second;
+                }
+                for(size_t p = 0; p < paramNames.size(); p++) {
+                    if (archetype.isParamHeterogeneous(p)) {
+                        os << ", " << ensureFtype(valueToString(ng.getParams()[p]), model.getPrecision());
+                    }
+                }
+                for(size_t p = 0; p < ng.getDerivedParams().size(); p++) {
+                    if (archetype.isDerivedParamHeterogeneous(p)) {
+                        os << ", " << ensureFtype(valueToString(ng.getDerivedParams()[p]), model.getPrecision());
+                    }
+                }
+                os << "},   // " << name << ENDL;
             }
+            os << "};" << ENDL << ENDL;
 
-            string offsetTrueSpkPost = sg->getTrgNeuronGroup()->isTrueSpikeRequired() ? sg->getOffsetPost("") : "";
-            os << "lSpk = glbSpk" << sg->getTrgNeuronGroup()->getName() << "[" << offsetTrueSpkPost << "ipost];" << ENDL;
+            os << "void calcNeuronsCPU" << mergedName << "(" << model.getPrecision() << " t)" << ENDL;
+            os << OB(55);
+            os << "for (unsigned int g = 0; g < " << mergedNeuronGroups[i].size() << "; g++)" << OB(56);
+            os << "const MergedNeuronGroup" << i << " &mergedGroup = mergedNeuronGroup" << i << "[g];" << ENDL;
 
-            if (sparse) { // SPARSE
-                // TODO: THIS NEEDS CHECKING AND FUNCTIONAL C.POST* ARRAYS
-                os << "npre = C" << s.first << ".revIndInG[lSpk + 1] - C" << s.first << ".revIndInG[lSpk];" << ENDL;
-                os << "for (int l = 0; l < npre; l++)" << OB(121);
-                os << "ipre = C" << s.first << ".revIndInG[lSpk] + l;" << ENDL;
-            }
-            else { // DENSE
-                os << "for (ipre = 0; ipre < " << sg->getSrcNeuronGroup()->getNumNeurons() << "; ipre++)" << OB(121);
+            // shadow the first group's globals with references to those of the group being updated
+            for(const auto &sym : symbols) {
+                os << sym.first << " &" << sym.second << " = *mergedGroup." << sym.second << ";" << ENDL;
             }
+            os << ENDL;
+
+            generateNeuronGroupUpdate(os, model, archetype, "mergedGroup.numNeurons");
+            os << CB(56);
+            os << CB(55);
+            closeGeneratedFile(os, groupName);
+        });
+    }
+    runGenerationTasks(tasks);
+
+    ofstream os;
 
-            string code = wu->getLearnPostCode();
-            substitute(code, "$(t)", "t");
-            // Code substitutions ----------------------------------------------------------------------------------
-            if (sparse) { // SPARSE
-                name_substitutions(code, "", wuVars.nameBegin, wuVars.nameEnd,
-                                   s.first + "[C" + s.first + ".remap[ipre]]");
+    string name = path + "/" + model.getName() + "_CODE/neuronFnct.cc";
+    openGeneratedFile(os, name);
+
+    // write header content
+    writeHeader(os);
+    os << ENDL;
+
+    // compiler/include control (include once)
+    os << "#ifndef _" << model.getName() << "_neuronFnct_cc" << ENDL;
+    os << "#define _" << model.getName() << "_neuronFnct_cc" << ENDL;
+    os << ENDL;
+
+    // write doxygen comment
+    os << "//-------------------------------------------------------------------------" << ENDL;
+    os << "/*! \\file neuronFnct.cc" << ENDL << ENDL;
+    os << "\\brief File generated from GeNN for the model " << model.getName();
+    os << " containing the the equivalent of neuron kernel function for the CPU-only version." << ENDL;
+    os << "*/" << ENDL;
+    os << "//-------------------------------------------------------------------------" << ENDL << ENDL;
+
+    os << "#include \"definitions.h\"" << ENDL << ENDL;
+
+    // declare the update functions of the individual and merged neuron groups
+    vector<string> updateFunctions;
+    for(const auto &n : model.getNeuronGroups()) {
+        if (mergedNeuronGroupIndices.find(n.first) == mergedNeuronGroupIndices.end()) {
+            updateFunctions.push_back("calcNeuronsCPU" + n.first);
+        }
+    }
+    for(size_t i = 0; i < mergedNeuronGroups.size(); i++) {
+        updateFunctions.push_back("calcNeuronsCPUMerged" + to_string(i));
+    }
+    for(const auto &f : updateFunctions) {
+        os << "void " << f << "(" << model.getPrecision() << " t);" << ENDL;
+    }
+    os << ENDL;
+
+    // function header
+    os << "void calcNeuronsCPU(" << model.getPrecision() << " t)" << ENDL;
+    os << OB(51);
+    for(const auto &f : updateFunctions) {
+        os << f << "(t);" << ENDL;
+    }
+    os << CB(51) << ENDL;
+    os << "#endif" << ENDL;
+    closeGeneratedFile(os, name);
+} 
+
+//--------------------------------------------------------------------------
+/*!
+  \brief Function that generates code that will simulate all synapses of the model on the CPU.
+*/
+//--------------------------------------------------------------------------
+
+void genSynapseFunction(const NNmodel &model, //!< Model description
+                        const string &path) //!< Path for code generation
+{
+    // the synapse dynamics, presynaptic and postsynaptic learning updates of each synapse group
+    // are generated as a separate translation unit
+    vector<function<void()>> tasks;
+    for(const auto &s : model.getSynapseGroups()) {
+        tasks.push_back([&model, &path, &s]()
+        {
+            ofstream os;
+            const string groupFileName = "synapseFnct" + s.first + ".cc";
+            const string groupName = path + "/" + model.getName() + "_CODE/" + groupFileName;
+            openGeneratedFile(os, groupName);
+            writeCPUSourcePreamble(os, model, groupFileName,
+                                   "the equivalent of the synapse kernel and learning kernel code for synapse group " + s.first + " for the CPU only version.");
+
+            if (model.getSynapseDynamicsGroups().find(s.first) != model.getSynapseDynamicsGroups().end()) {
+                generateSynapseDynamicsFunction(os, model, s.first, &s.second);
             }
-            else { // DENSE
-                name_substitutions(code, "", wuVars.nameBegin, wuVars.nameEnd,
-                                   s.first + "[lSpk + " + to_string(sg->getTrgNeuronGroup()->getNumNeurons()) + " * ipre]");
+            generateSynapseUpdateFunction(os, model, s.first, &s.second);
+            if (model.getSynapsePostLearnGroups().find(s.first) != model.getSynapsePostLearnGroups().end()) {
+                generatePostLearnFunction(os, model, s.first, &s.second);
             }
-            StandardSubstitutions::weightUpdatePostLearn(code, sg,
-                                                         wuDerivedParams, wuExtraGlobalParams,
-                                                         sparse ?  "C" + s.first + ".revInd[ipre]" : "ipre",
-                                                         "lSpk", "", model.getPrecision());
-            // end Code substitutions -------------------------------------------------------------------------
-            os << code << ENDL;
+            closeGeneratedFile(os, groupName);
+        });
+    }
+    runGenerationTasks(tasks);
 
-            os << CB(121);
-            os << CB(910);
-            os << CB(950);
+    ofstream os;
+
+    string name = path + "/" + model.getName() + "_CODE/synapseFnct.cc";
+    openGeneratedFile(os, name);
+
+    // write header content
+    writeHeader(os);
+    os << ENDL;
+
+    // compiler/include control (include once)
+    os << "#ifndef _" << model.getName() << "_synapseFnct_cc" << ENDL;
+    os << "#define _" << model.getName() << "_synapseFnct_cc" << ENDL;
+    os << ENDL;
+
+    // write doxygen comment
+    os << "//-------------------------------------------------------------------------" << ENDL;
+    os << "/*! \\file synapseFnct.cc" << ENDL << ENDL;
+    os << "\\brief File generated from GeNN for the model " << model.getName() << " containing the equivalent of the synapse kernel and learning kernel functions for the CPU only version." << ENDL;
+    os << "*/" << ENDL;
+    os << "//-------------------------------------------------------------------------" << ENDL << ENDL;
+
+    os << "#include \"definitions.h\"" << ENDL << ENDL;
+
+    // declare the functions of the individual synapse groups
+    vector<string> synDynGroups;
+    for(const auto &s : model.getSynapseDynamicsGroups()) {
+        if (!model.findSynapseGroup(s.first)->getWUModel()->getSynapseDynamicsCode().empty()) {
+            synDynGroups.push_back(s.first);
+            os << "void calcSynapseDynamicsCPU" << s.first << "(" << model.getPrecision() << " t);" << ENDL;
         }
-        os << CB(811);
+    }
+    for(const auto &s : model.getSynapseGroups()) {
+        os << "void calcSynapsesCPU" << s.first << "(" << model.getPrecision() << " t);" << ENDL;
+    }
+    for(const auto &s : model.getSynapsePostLearnGroups()) {
+        os << "void learnSynapsesPostHost" << s.first << "(" << model.getPrecision() << " t);" << ENDL;
     }
     os << ENDL;
 
+    // synapse dynamics function
+    os << "void calcSynapseDynamicsCPU(" << model.getPrecision() << " t)" << ENDL;
+    os << OB(1000);
+    os << "// execute internal synapse dynamics if any" << ENDL;
+    for(const auto &s : synDynGroups) {
+        os << "calcSynapseDynamicsCPU" << s << "(t);" << ENDL;
+    }
+    os << CB(1000);
+
+    // synapse function
+    os << "void calcSynapsesCPU(" << model.getPrecision() << " t)" << ENDL;
+    os << OB(1001);
+    for(const auto &s : model.getSynapseGroups()) {
+        os << "calcSynapsesCPU" << s.first << "(t);" << ENDL;
+    }
+    os << CB(1001);
+    os << ENDL;
+
+    // function for learning synapses, post-synaptic spikes
+    if (!model.getSynapsePostLearnGroups().empty()) {
+        os << "void learnSynapsesPostHost(" << model.getPrecision() << " t)" << ENDL;
+        os << OB(811);
+        for(const auto &s : model.getSynapsePostLearnGroups()) {
+            os << "learnSynapsesPostHost" << s.first << "(t);" << ENDL;
+        }
+        os << CB(811);
+    }
+    os << ENDL;
 
     os << "#endif" << ENDL;
-    os.close();
+    closeGeneratedFile(os, name);
 
 //  cout << "exiting genSynapseFunction" << endl;
 }
@@ -20,6 +20,7 @@
 //-------------------------------------------------------------------------
 
 #include "generateKernels.h"
+#include "generateALL.h"
 #include "global.h"
 #include "utils.h"
 #include "standardGeneratedSections.h"
@@ -50,6 +51,17 @@ string getFloatAtomicAdd(const string &ftype)
         return "atomicAdd";
     }
 }
+
+// extend the condition under which threads update a group which is only updated every updatePeriod time steps
+// to the kernels launched on those time steps - kernels are not passed the time step so it is recovered from t
+string addUpdatePeriodCondition(const string &condition, unsigned int updatePeriod)
+{
+    if (updatePeriod == 1) {
+        return condition;
+    }
+    return "(" + condition + ") && ((((unsigned long long) rint(t / DT)) % " + to_string(updatePeriod) + ") == 0)";
+}
+
 // parallelisation along pre-synaptic spikes, looped over post-synaptic neurons
 void generatePreParallelisedSparseCode(
     ostream &os, //!< output stream for code
@@ -66,7 +78,7 @@ void generatePreParallelisedSparseCode(
     // Create iteration context to iterate over the variables; derived and extra global parameters
     DerivedParamNameIterCtx wuDerivedParams(wu->getDerivedParams());
     ExtraGlobalParamNameIterCtx wuExtraGlobalParams(wu->getExtraGlobalParams());
-    VarNameIterCtx wuVars(wu->getVars());
+    VarNameIterCtx wuVars(sg.getNonConstantWUVars());
 
     //int maxConnections;
     if (sg.isPSAtomicAddRequired(synapseBlkSz)) {
@@ -182,7 +194,7 @@ void generatePostParallelisedCode(
     // Create iteration context to iterate over the variables; derived and extra global parameters
     DerivedParamNameIterCtx wuDerivedParams(wu->getDerivedParams());
     ExtraGlobalParamNameIterCtx wuExtraGlobalParams(wu->getExtraGlobalParams());
-    VarNameIterCtx wuVars(wu->getVars());
+    VarNameIterCtx wuVars(sg.getNonConstantWUVars());
 
     os << "// process presynaptic events: " << (evnt ? "Spike type events" : "True Spikes") << ENDL;
     os << "for (r = 0; r < numSpikeSubsets" << postfix << "; r++)" << OB(90);
@@ -357,7 +369,7 @@ void genNeuronKernel(const NNmodel &model, //!< Model description
     ofstream os;
 
     string name = path + "/" + model.getName() + "_CODE/neuronKrnl.cc";
-    os.open(name.c_str());
+    openGeneratedFile(os, name);
 
     // write header content
     writeHeader(os);
@@ -475,7 +487,7 @@ void genNeuronKernel(const NNmodel &model, //!< Model description
         os << ENDL;
 
         os << "// only do this for existing neurons" << ENDL;
-        os << "if (" << localID << " < " << n.second.getNumNeurons() << ")" << OB(20);
+        os << "if (" << addUpdatePeriodCondition(localID + " < " + to_string(n.second.getNumNeurons()), n.second.getUpdatePeriod()) << ")" << OB(20);
 
         os << "// pull neuron variables in a coalesced access" << ENDL;
 
@@ -676,7 +688,7 @@ void genNeuronKernel(const NNmodel &model, //!< Model description
     os << CB(5) << ENDL; // end of neuron kernel
 
     os << "#endif" << ENDL;
-    os.close();
+    closeGeneratedFile(os, name);
 }
 
 //-------------------------------------------------------------------------
@@ -697,7 +709,7 @@ void genSynapseKernel(const NNmodel &model, //!< Model description
 
 //    cout << "entering genSynapseKernel" << endl;
     string name = path + "/" + model.getName() + "_CODE/synapseKrnl.cc";
-    os.open(name.c_str());
+    openGeneratedFile(os, name);
 
     // write header content
     writeHeader(os);
@@ -747,16 +759,16 @@ void genSynapseKernel(const NNmodel &model, //!< Model description
             if (!wu->getSynapseDynamicsCode().empty()) {
                 // Create iteration context to iterate over the variables and derived parameters
                 DerivedParamNameIterCtx wuDerivedParams(wu->getDerivedParams());
-                VarNameIterCtx wuVars(wu->getVars());
+                VarNameIterCtx wuVars(sg->getNonConstantWUVars());
 
                 os << "// synapse group " << s.first << ENDL;
                 if (firstSynapseDynamicsGroup) {
-                    os << "if (id < " << s.second.second << ")" << OB(77);
+                    os << "if (" << addUpdatePeriodCondition("id < " + to_string(s.second.second), sg->getUpdatePeriod()) << ")" << OB(77);
                     localID = "id";
                     firstSynapseDynamicsGroup = false;
                 }
                 else {
-                    os << "if ((id >= " << s.second.first << ") && (id < " << s.second.second << "))" << OB(77);
+                    os << "if (" << addUpdatePeriodCondition("(id >= " + to_string(s.second.first) + ") && (id < " + to_string(s.second.second) + ")", sg->getUpdatePeriod()) << ")" << OB(77);
                     os << "unsigned int lid = id - " << s.second.first << ";" << ENDL;
                     localID = "lid";
                 }
@@ -1061,7 +1073,7 @@ void genSynapseKernel(const NNmodel &model, //!< Model description
              // Create iteration context to iterate over the variables; derived and extra global parameters
             DerivedParamNameIterCtx wuDerivedParams(wu->getDerivedParams());
             ExtraGlobalParamNameIterCtx wuExtraGlobalParams(wu->getExtraGlobalParams());
-            VarNameIterCtx wuVars(wu->getVars());
+            VarNameIterCtx wuVars(sg->getNonConstantWUVars());
 
             string code = wu->getLearnPostCode();
             substitute(code, "$(t)", "t");
@@ -1122,7 +1134,7 @@ void genSynapseKernel(const NNmodel &model, //!< Model description
     os << ENDL;
     
     os << "#endif" << ENDL;
-    os.close();
+    closeGeneratedFile(os, name);
 
 //    cout << "exiting genSynapseKernel" << endl;
 }
@@ -21,6 +21,7 @@
 //--------------------------------------------------------------------------
 
 #include "generateRunner.h"
+#include "generateALL.h"
 #include "global.h"
 #include "utils.h"
 #include "codeGenUtils.h"
@@ -29,6 +30,11 @@
 #include <stdint.h>
 #include <algorithm>
 #include <cfloat>
+#include <functional>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 //--------------------------------------------------------------------------
 // Anonymous namespace
@@ -158,6 +164,96 @@ void free_variable(ofstream &os, const string &name, bool zeroCopy)
     free_host_variable(os, name);
     free_device_variable(os, name, zeroCopy);
 }
+
+//--------------------------------------------------------------------------
+//! \brief This function lists the per-group timing statistics used by the generated CPU code as (variable name, group name, phase) triples
+//--------------------------------------------------------------------------
+vector<tuple<string, string, string>> get_group_timing_stats(const NNmodel &model)
+{
+    vector<tuple<string, string, string>> stats;
+    for(const auto &n : model.getNeuronGroups()) {
+        stats.emplace_back("neuronTiming" + n.first, n.first, "neuron");
+    }
+    for(const auto &s : model.getSynapseGroups()) {
+        stats.emplace_back("synapseTiming" + s.first, s.first, "synapse");
+    }
+    for(const auto &s : model.getSynapsePostLearnGroups()) {
+        stats.emplace_back("learningTiming" + s.first, s.first, "learning");
+    }
+    for(const auto &s : model.getSynapseDynamicsGroups()) {
+        if (!model.findSynapseGroup(s.first)->getWUModel()->getSynapseDynamicsCode().empty()) {
+            stats.emplace_back("synDynTiming" + s.first, s.first, "synapseDynamics");
+        }
+    }
+    return stats;
+}
+
+//--------------------------------------------------------------------------
+//! \brief This function generates one entry of the table describing the model's state arrays (see VarDescriptor)
+//--------------------------------------------------------------------------
+void var_descriptor(ofstream &os, const NNmodel &model, const string &name, const string &group, const string &type,
+                    const string &count, const string &connN, const string &hostVar, const string &deviceVar)
+{
+    const string elementType = (type == "scalar") ? model.getPrecision() : type;
+    os << "    {\"" << name << "\", \"" << group << "\", \"" << elementType << "\", sizeof(" << elementType << "), " << count << ", ";
+    os << (connN.empty() ? "NULL" : "&" + connN) << ", (void *const *)&" << hostVar << ", ";
+#ifndef CPU_ONLY
+    os << "(void *const *)&" << deviceVar;
+#else
+    USE(deviceVar);
+    os << "NULL";
+#endif
+    os << "}," << ENDL;
+}
+
+void var_descriptor(ofstream &os, const NNmodel &model, const string &name, const string &group, const string &type, size_t count)
+{
+    var_descriptor(os, model, name, group, type, to_string(count), "", name + group, "d_" + name + group);
+}
+
+//--------------------------------------------------------------------------
+//! \brief This function adds the (name, value) pairs of the parameters and derived parameters in runtimeParams to values, in model order
+//--------------------------------------------------------------------------
+void add_runtime_param_values(const vector<string> &paramNames, const vector<double> &params,
+                              const NewModels::Base::DerivedParamVec &derivedParams, const vector<double> &derivedParamValues,
+                              const set<string> &runtimeParams, vector<pair<string, double>> &values)
+{
+    for(size_t i = 0; i < paramNames.size() && i < params.size(); i++) {
+        if (runtimeParams.find(paramNames[i]) != runtimeParams.end()) {
+            values.emplace_back(paramNames[i], params[i]);
+        }
+    }
+    for(size_t i = 0; i < derivedParams.size() && i < derivedParamValues.size(); i++) {
+        if (runtimeParams.find(derivedParams[i].first) != runtimeParams.end()) {
+            values.emplace_back(derivedParams[i].first, derivedParamValues[i]);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------
+//! \brief This function lists the structures holding runtime parameters as (type name, variable name, group name, parameter values) tuples
+//--------------------------------------------------------------------------
+vector<tuple<string, string, string, vector<pair<string, double>>>> get_runtime_params(const NNmodel &model)
+{
+    vector<tuple<string, string, string, vector<pair<string, double>>>> runtimeParams;
+    for(const auto &n : model.getNeuronGroups()) {
+        if (n.second.isRuntimeParamsRequired()) {
+            const auto *nm = n.second.getNeuronModel();
+            runtimeParams.emplace_back("RuntimeParams" + n.first, n.second.getRuntimeParamsName(), n.first, vector<pair<string, double>>());
+            add_runtime_param_values(nm->getParamNames(), n.second.getParams(), nm->getDerivedParams(), n.second.getDerivedParams(),
+                                     n.second.getRuntimeParams(), get<3>(runtimeParams.back()));
+        }
+    }
+    for(const auto &s : model.getSynapseGroups()) {
+        if (s.second.isWURuntimeParamsRequired()) {
+            const auto *wu = s.second.getWUModel();
+            runtimeParams.emplace_back("WURuntimeParams" + s.first, s.second.getWURuntimeParamsName(), s.first, vector<pair<string, double>>());
+            add_runtime_param_values(wu->getParamNames(), s.second.getWUParams(), wu->getDerivedParams(), s.second.getWUDerivedParams(),
+                                     s.second.getWURuntimeParams(), get<3>(runtimeParams.back()));
+        }
+    }
+    return runtimeParams;
+}
 }
 
 //--------------------------------------------------------------------------
@@ -199,7 +295,7 @@ void genRunner(const NNmodel &model, //!< Model description
 
     // this file contains helpful macros and is separated out so that it can also be used by other code that is compiled separately
     string definitionsName= path + "/" + model.getName() + "_CODE/definitions.h";
-    os.open(definitionsName.c_str());
+    openGeneratedFile(os, definitionsName);
     writeHeader(os);
     os << ENDL;
 
@@ -216,9 +312,15 @@ void genRunner(const NNmodel &model, //!< Model description
 
     os << "#include \"utils.h\"" << ENDL;
     if (model.isTimingEnabled()) os << "#include \"hr_time.h\"" << ENDL;
+    if (model.isGroupTimingEnabled()) os << "#include \"groupTiming.h\"" << ENDL;
+    if (model.isEventCountingEnabled()) os << "#include \"eventCounters.h\"" << ENDL;
+    if (model.isRealTimePacingEnabled()) os << "#include \"realTimePacer.h\"" << ENDL;
     os << "#include \"sparseUtils.h\"" << ENDL << ENDL;
     os << "#include \"sparseProjection.h\"" << ENDL;
+    os << "#include \"varDescriptor.h\"" << ENDL;
+    if (model.inputQueueInUse()) os << "#include \"inputQueue.h\"" << ENDL;
     os << "#include <stdint.h>" << ENDL;
+    os << "#include <type_traits>" << ENDL;
     os << ENDL;
 
 #ifndef CPU_ONLY
@@ -250,6 +352,9 @@ void genRunner(const NNmodel &model, //!< Model description
         os << "#define DT " << to_string(model.getDT()) << ENDL;
     }
 
+    // write number of instances of the model simulated together
+    os << "#define BATCH_SIZE " << model.getBatchSize() << ENDL;
+
     // write MYRAND macro
     os << "#ifndef MYRAND" << ENDL;
     os << "#define MYRAND(Y,X) Y = Y * 1103515245 + 12345; X = (Y >> 16);" << ENDL;
@@ -308,8 +413,44 @@ void genRunner(const NNmodel &model, //!< Model description
             os << "extern CStopWatch synDyn_timer;" << ENDL;
         }
     } 
+    if (model.isGroupTimingEnabled()) {
+        for(const auto &g : get_group_timing_stats(model)) {
+            os << "extern GroupTimingStats " << get<0>(g) << ";" << ENDL;
+        }
+        os << "extern GroupTimingStats *const groupTimingTable[];" << ENDL;
+        os << "extern const unsigned int numGroupTimingStats;" << ENDL;
+    }
+    if (model.isRealTimePacingEnabled()) {
+        os << "extern RealTimePacer realTimePacer;" << ENDL;
+    }
+    if (model.isEventCountingEnabled()) {
+        for(const auto &n : model.getNeuronGroups()) {
+            os << "extern NeuronGroupCounters neuronCounters" << n.first << ";" << ENDL;
+        }
+        for(const auto &s : model.getSynapseGroups()) {
+            os << "extern SynapseGroupCounters synapseCounters" << s.first << ";" << ENDL;
+        }
+    }
     os << ENDL;
 
+    const auto runtimeParams = get_runtime_params(model);
+    if (!runtimeParams.empty()) {
+        os << "// ------------------------------------------------------------------------" << ENDL;
+        os << "// runtime parameters" << ENDL;
+        os << ENDL;
+
+        for(const auto &r : runtimeParams) {
+            os << "struct " << get<0>(r) << ENDL;
+            os << OB(1170);
+            for(const auto &p : get<3>(r)) {
+                os << model.getPrecision() << " " << p.first << ";" << ENDL;
+            }
+            os << CB(1170) << ";" << ENDL;
+            os << "extern " << get<0>(r) << " " << get<1>(r) << ";" << ENDL;
+            os << ENDL;
+        }
+    }
+
 
     //---------------------------------
     // HOST AND DEVICE NEURON VARIABLES
@@ -328,19 +469,41 @@ void genRunner(const NNmodel &model, //!< Model description
         if (n.second.isDelayRequired()) {
             os << "extern unsigned int spkQuePtr" << n.first << ";" << ENDL;
         }
+        if (n.second.isQuiescenceSkippingEnabled()) {
+            os << "extern bool quiescent" << n.first << ";" << ENDL;
+        }
         if (n.second.isSpikeTimeRequired()) {
             extern_variable_def(os, model.getPrecision()+" *", "sT"+n.first);
         }
+        if (n.second.isSpikeRecordingEnabled()) {
+            extern_variable_def(os, "unsigned int *", "recordSpkCnt"+n.first);
+            extern_variable_def(os, "unsigned int *", "recordSpk"+n.first);
+        }
 
         auto neuronModel = n.second.getNeuronModel();
-        for(auto const &v : neuronModel->getVars()) {
+        for(auto const &v : n.second.getNonConstantVars()) {
             extern_variable_def(os, v.second +" *", v.first + n.first);
         }
         for(auto const &v : neuronModel->getExtraGlobalParams()) {
             extern_variable_def(os, v.second, v.first + n.first);
         }
+        if (n.second.isInputQueueEnabled()) {
+            os << "extern InputQueue<scalar> inputQueue" << n.first << ";" << ENDL;
+        }
+    }
+    if (model.spikeRecordingInUse()) {
+        os << "extern unsigned int numSpikeRecordingSteps;" << ENDL;
     }
     os << ENDL;
+    for(const auto &n : model.getNeuronGroups()) {
+        if (n.second.isInputQueueEnabled()) {
+            // indices of state variables which can be targetted by VALUES frames
+            auto neuronModelVars = n.second.getNeuronModel()->getVars();
+            for (size_t j = 0; j < neuronModelVars.size(); j++) {
+                os << "#define inputTarget" << neuronModelVars[j].first << n.first << " " << j << ENDL;
+            }
+        }
+    }
     for(auto &n : model.getNeuronGroups()) {
         os << "#define glbSpkShift" << n.first;
         if (n.second.isDelayRequired()) {
@@ -400,6 +563,13 @@ void genRunner(const NNmodel &model, //!< Model description
 
     for(const auto &s : model.getSynapseGroups()) {
         extern_variable_def(os, model.getPrecision()+" *", "inSyn" + s.first);
+        if (s.second.isPSLazyDecayEnabled()) {
+            os << "extern " << model.getPrecision() << " inSynScale" << s.first << ";" << ENDL;
+        }
+        if (s.second.isDendriticDelayRequired()) {
+            extern_variable_def(os, model.getPrecision()+" *", "denDelay" + s.first);
+            os << "extern unsigned int denDelayPtr" << s.first << ";" << ENDL;
+        }
         if (s.second.getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
             extern_variable_def(os, "uint32_t *", "gp" + s.first);
         }
@@ -408,7 +578,7 @@ void genRunner(const NNmodel &model, //!< Model description
         }
 
         if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) { // not needed for GLOBALG
-            for(const auto &v : s.second.getWUModel()->getVars()) {
+            for(const auto &v : s.second.getNonConstantWUVars()) {
                 extern_variable_def(os, v.second + " *", v.first + s.first);
             }
             for(const auto &v : s.second.getPSModel()->getVars()) {
@@ -429,6 +599,14 @@ void genRunner(const NNmodel &model, //!< Model description
   and making g member a synapse variable.*/" << ENDL;
     os << ENDL;
 
+    os << "// ------------------------------------------------------------------------" << ENDL;
+    os << "// table describing all state arrays and function to find a variable of a group in it" << ENDL;
+    os << ENDL;
+    os << "extern const VarDescriptor varDescriptorTable[];" << ENDL;
+    os << "extern const unsigned int numVarDescriptors;" << ENDL;
+    os << "const VarDescriptor *getVarDescriptor(const char *name, const char *group);" << ENDL;
+    os << ENDL;
+
 
     //--------------------------
     // HOST AND DEVICE FUNCTIONS
@@ -588,6 +766,17 @@ void genRunner(const NNmodel &model, //!< Model description
         }
     }
 
+    if (model.spikeRecordingInUse()) {
+        os << "// ------------------------------------------------------------------------" << ENDL;
+        os << "// Function to (re)allocate the buffers into which stepTimeCPU(numSteps) and stepTimeGPU(numSteps)" << ENDL;
+        os << "// record the spikes of each time step of calls of up to numSteps time steps. The spikes of" << ENDL;
+        os << "// instance b of a group in step s of the last call start at recordSpk<group>[((s * BATCH_SIZE) + b) * N]" << ENDL;
+        os << "// and there are recordSpkCnt<group>[(s * BATCH_SIZE) + b] of them" << ENDL;
+        os << ENDL;
+        os << "void allocateSpikeRecording(unsigned int numSteps);" << ENDL;
+        os << ENDL;
+    }
+
     os << "// ------------------------------------------------------------------------" << ENDL;
     os << "// Function to (re)set all model variables to their compile-time, homogeneous initial" << ENDL;
     os << "// values. Note that this typically includes synaptic weight values. The function" << ENDL;
@@ -632,23 +821,90 @@ void genRunner(const NNmodel &model, //!< Model description
     os << "// ------------------------------------------------------------------------" << ENDL;
     os << "// Throw an error for \"old style\" time stepping calls (using CPU)" << ENDL;
     os << ENDL;
-    os << "template <class T>" << ENDL;
+    os << "template <class T, typename std::enable_if<!std::is_integral<T>::value, int>::type = 0>" << ENDL;
     os << "void stepTimeCPU(T arg1, ...)" << OB(101);
     os << "gennError(\"Since GeNN 2.2 the call to step time has changed to not take any arguments. You appear to attempt to pass arguments. This is no longer supported. See the GeNN 2.2. release notes and the manual for examples how to pass data like, e.g., Poisson rates and direct inputs, that were previously handled through arguments.\");" << ENDL; 
     os << CB(101);
     os<< ENDL;
 
+    if (model.isGroupTimingEnabled()) {
+        os << "// ------------------------------------------------------------------------" << ENDL;
+        os << "// Functions to reset the per-group timing statistics and to write them to a JSON file" << ENDL;
+        os << ENDL;
+        os << "void resetGroupTiming();" << ENDL;
+        os << "void dumpGroupTiming(const char *filename);" << ENDL;
+        os << ENDL;
+    }
+
+    if (model.isEventCountingEnabled()) {
+        os << "// ------------------------------------------------------------------------" << ENDL;
+        os << "// Functions to reset all event counters and to sum the synapse updates over all synapse groups" << ENDL;
+        os << ENDL;
+        os << "void resetEventCounters();" << ENDL;
+        os << "unsigned long long getTotalSynapseUpdates();" << ENDL;
+        os << ENDL;
+    }
+
+    if (model.isGroupTimingEnabled() && model.isEventCountingEnabled()) {
+        os << "// ------------------------------------------------------------------------" << ENDL;
+        os << "// Function to write the per-group timing and event counts to a profile which NNmodel::setProfile can read" << ENDL;
+        os << ENDL;
+        os << "void dumpProfile(const char *filename);" << ENDL;
+        os << ENDL;
+    }
+
+    if (!runtimeParams.empty()) {
+        os << "// ------------------------------------------------------------------------" << ENDL;
+        os << "// Functions to change runtime parameters between time steps. Kernels receive the current values when they are launched" << ENDL;
+        os << ENDL;
+        for(const auto &r : runtimeParams) {
+            for(const auto &p : get<3>(r)) {
+                os << "void set" << p.first << get<2>(r) << "(" << model.getPrecision() << " value);" << ENDL;
+            }
+        }
+        os << ENDL;
+    }
+
+    if (model.inputQueueInUse()) {
+        os << "// ------------------------------------------------------------------------" << ENDL;
+        os << "// Functions to apply all queued input frames which are due at the current time step." << ENDL;
+        os << "// stepTimeCPU() calls these itself; when using the GPU call them and push the state before stepTimeGPU()" << ENDL;
+        os << ENDL;
+        for(const auto &n : model.getNeuronGroups()) {
+            if (n.second.isInputQueueEnabled()) {
+                os << "void applyInputQueue" << n.first << "();" << ENDL;
+            }
+        }
+        os << ENDL;
+    }
+
     os << "// ------------------------------------------------------------------------" << ENDL;
     os << "// the actual time stepping procedure (using CPU)" << ENDL;
     os << ENDL;
     os << "void stepTimeCPU();" << ENDL;
     os << ENDL;
 
+    os << "// ------------------------------------------------------------------------" << ENDL;
+    os << "// numSteps time steps of the time stepping procedure in one call (using CPU)" << ENDL;
+    os << ENDL;
+    os << "void stepTimeCPU(unsigned int numSteps);" << ENDL;
+    os << ENDL;
+
+    if (model.isRealTimePacingEnabled()) {
+        os << "// ------------------------------------------------------------------------" << ENDL;
+        os << "// numSteps time steps of the time stepping procedure (using CPU) paced to wall-clock time by realTimePacer," << ENDL;
+        os << "// which also holds the ratio of simulated to wall-clock time, the overrun callback and the step statistics" << ENDL;
+        os << ENDL;
+        os << "void stepTimeRealTimeCPU(unsigned int numSteps);" << ENDL;
+        os << "void dumpRealTimeStats(const char *filename);" << ENDL;
+        os << ENDL;
+    }
+
 #ifndef CPU_ONLY
     os << "// ------------------------------------------------------------------------" << ENDL;
     os << "// Throw an error for \"old style\" time stepping calls (using GPU)" << ENDL;
     os << ENDL;
-    os << "template <class T>" << ENDL;
+    os << "template <class T, typename std::enable_if<!std::is_integral<T>::value, int>::type = 0>" << ENDL;
     os << "void stepTimeGPU(T arg1, ...)" << OB(101);
     os << "gennError(\"Since GeNN 2.2 the call to step time has changed to not take any arguments. You appear to attempt to pass arguments. This is no longer supported. See the GeNN 2.2. release notes and the manual for examples how to pass data like, e.g., Poisson rates and direct inputs, that were previously handled through arguments.\");" << ENDL;
     os << CB(101);
@@ -659,10 +915,16 @@ void genRunner(const NNmodel &model, //!< Model description
     os << ENDL;
     os << "void stepTimeGPU();" << ENDL;
     os << ENDL;
+
+    os << "// ------------------------------------------------------------------------" << ENDL;
+    os << "// numSteps time steps of the time stepping procedure in one call (using GPU)" << ENDL;
+    os << ENDL;
+    os << "void stepTimeGPU(unsigned int numSteps);" << ENDL;
+    os << ENDL;
 #endif
 
     os << "#endif" << ENDL;
-    os.close();
+    closeGeneratedFile(os, definitionsName);
 
 
     //========================
@@ -670,7 +932,7 @@ void genRunner(const NNmodel &model, //!< Model description
     //========================
 
     string supportCodeName= path + "/" + model.getName() + "_CODE/support_code.h";
-    os.open(supportCodeName.c_str());
+    openGeneratedFile(os, supportCodeName);
     writeHeader(os);
     os << ENDL;
     
@@ -685,6 +947,9 @@ void genRunner(const NNmodel &model, //!< Model description
     os << "#define SUPPORT_CODE_H" << ENDL;
     // write the support codes
     os << "// support code for neuron and synapse models" << ENDL;
+    os << "// (given internal linkage as this header is included by the update code of every group)" << ENDL;
+    os << "namespace" << ENDL;
+    os << "{" << ENDL;
     for(const auto &n : model.getNeuronGroups()) {
         if (!n.second.getNeuronModel()->getSupportCode().empty()) {
             os << "namespace " << n.first << "_neuron" << OB(11) << ENDL;
@@ -718,13 +983,14 @@ void genRunner(const NNmodel &model, //!< Model description
         }
 
     }
+    os << "}   // anonymous namespace" << ENDL;
     os << "#endif" << ENDL;
-    os.close();
+    closeGeneratedFile(os, supportCodeName);
     
 
     //cout << "entering genRunner" << ENDL;
     string runnerName= path + "/" + model.getName() + "_CODE/runner.cc";
-    os.open(runnerName.c_str());
+    openGeneratedFile(os, runnerName);
     writeHeader(os);
     os << ENDL;
 
@@ -745,6 +1011,8 @@ void genRunner(const NNmodel &model, //!< Model description
     os << "#include <ctime>" << ENDL;
     os << "#include <cassert>" << ENDL;
     os << "#include <stdint.h>" << ENDL;
+    if (model.isTimingEnabled()) os << "#include <chrono>" << ENDL;
+    if (model.spikeRecordingInUse()) os << "#include <cstring>" << ENDL;
     os << ENDL;
 
 
@@ -785,8 +1053,46 @@ void genRunner(const NNmodel &model, //!< Model description
             os << "CStopWatch synDyn_timer;" << ENDL;
         }
     } 
+    if (model.isGroupTimingEnabled()) {
+        const auto groupTimingStats = get_group_timing_stats(model);
+        for(const auto &g : groupTimingStats) {
+            os << "GroupTimingStats " << get<0>(g) << "(\"" << get<1>(g) << "\", \"" << get<2>(g) << "\");" << ENDL;
+        }
+        os << "GroupTimingStats *const groupTimingTable[] = {";
+        for(size_t i = 0; i < groupTimingStats.size(); i++) {
+            os << ((i == 0) ? "" : ", ") << "&" << get<0>(groupTimingStats[i]);
+        }
+        os << "};" << ENDL;
+        os << "const unsigned int numGroupTimingStats = " << groupTimingStats.size() << ";" << ENDL;
+    }
+    if (model.isRealTimePacingEnabled()) {
+        os << "RealTimePacer realTimePacer(DT);" << ENDL;
+    }
+    if (model.isEventCountingEnabled()) {
+        for(const auto &n : model.getNeuronGroups()) {
+            os << "NeuronGroupCounters neuronCounters" << n.first << ";" << ENDL;
+        }
+        for(const auto &s : model.getSynapseGroups()) {
+            os << "SynapseGroupCounters synapseCounters" << s.first << ";" << ENDL;
+        }
+    }
     os << ENDL;
 
+    if (!runtimeParams.empty()) {
+        os << "// ------------------------------------------------------------------------" << ENDL;
+        os << "// runtime parameters" << ENDL;
+        os << ENDL;
+
+        for(const auto &r : runtimeParams) {
+            os << get<0>(r) << " " << get<1>(r) << " = {";
+            for(size_t i = 0; i < get<3>(r).size(); i++) {
+                os << ((i == 0) ? "" : ", ") << ensureFtype(valueToString(get<3>(r)[i].second), model.getPrecision());
+            }
+            os << "};" << ENDL;
+        }
+        os << ENDL;
+    }
+
 
     //---------------------------------
     // HOST AND DEVICE NEURON VARIABLES
@@ -811,17 +1117,30 @@ void genRunner(const NNmodel &model, //!< Model description
             os << "__device__ volatile unsigned int dd_spkQuePtr" << n.first << ";" << ENDL;
 #endif
         }
+        if (n.second.isQuiescenceSkippingEnabled()) {
+            os << "bool quiescent" << n.first << ";" << ENDL;
+        }
         if (n.second.isSpikeTimeRequired()) {
             variable_def(os, model.getPrecision()+" *", "sT"+n.first);
         }
+        if (n.second.isSpikeRecordingEnabled()) {
+            variable_def(os, "unsigned int *", "recordSpkCnt"+n.first);
+            variable_def(os, "unsigned int *", "recordSpk"+n.first);
+        }
 
         auto neuronModel = n.second.getNeuronModel();
-        for(auto const &v : neuronModel->getVars()) {
+        for(auto const &v : n.second.getNonConstantVars()) {
             variable_def(os, v.second + " *", v.first + n.first);
         }
         for(auto const &v : neuronModel->getExtraGlobalParams()) {
             os << v.second << " " <<  v.first << n.first << ";" << ENDL;
         }
+        if (n.second.isInputQueueEnabled()) {
+            os << "InputQueue<scalar> inputQueue" << n.first << "(" << n.second.getInputQueueCapacity() << ", " << n.second.getNumNeurons() << ");" << ENDL;
+        }
+    }
+    if (model.spikeRecordingInUse()) {
+        os << "unsigned int numSpikeRecordingSteps = 0;" << ENDL;
     }
     os << ENDL;
 
@@ -838,6 +1157,13 @@ void genRunner(const NNmodel &model, //!< Model description
         const auto *psm = s.second.getPSModel();
 
         variable_def(os, model.getPrecision()+" *", "inSyn"+s.first);
+        if (s.second.isPSLazyDecayEnabled()) {
+            os << model.getPrecision() << " inSynScale" << s.first << ";" << ENDL;
+        }
+        if (s.second.isDendriticDelayRequired()) {
+            variable_def(os, model.getPrecision()+" *", "denDelay"+s.first);
+            os << "unsigned int denDelayPtr" << s.first << ";" << ENDL;
+        }
         if (s.second.getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
             variable_def(os, "uint32_t *", "gp"+s.first);
         }
@@ -864,7 +1190,7 @@ void genRunner(const NNmodel &model, //!< Model description
 #endif
         }
         if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) { // not needed for GLOBALG, INDIVIDUALID
-            for(const auto &v : wu->getVars()) {
+            for(const auto &v : s.second.getNonConstantWUVars()) {
                 variable_def(os, v.second + " *", v.first + s.first);
             }
             for(const auto &v : psm->getVars()) {
@@ -879,6 +1205,95 @@ void genRunner(const NNmodel &model, //!< Model description
     os << ENDL;
 
 
+    //--------------------------
+    // STATE ARRAY DESCRIPTORS
+
+    os << "// ------------------------------------------------------------------------" << ENDL;
+    os << "// state array descriptors" << ENDL;
+    os << ENDL;
+    os << "const VarDescriptor varDescriptorTable[] = {" << ENDL;
+    unsigned int numVarDescriptors = 0;
+    const unsigned int batchSize = model.getBatchSize();
+    for(const auto &n : model.getNeuronGroups()) {
+        // **NOTE** batched models have no delay slots
+        const unsigned int numNeurons = n.second.getNumNeurons() * batchSize;
+        const unsigned int numSlots = n.second.getNumDelaySlots();
+        var_descriptor(os, model, "glbSpkCnt", n.first, "unsigned int", (n.second.isTrueSpikeRequired() ? numSlots : 1) * batchSize);
+        var_descriptor(os, model, "glbSpk", n.first, "unsigned int", n.second.isTrueSpikeRequired() ? numNeurons * numSlots : numNeurons);
+        numVarDescriptors += 2;
+        if (n.second.isSpikeEventRequired()) {
+            var_descriptor(os, model, "glbSpkCntEvnt", n.first, "unsigned int", numSlots * batchSize);
+            var_descriptor(os, model, "glbSpkEvnt", n.first, "unsigned int", numNeurons * numSlots);
+            numVarDescriptors += 2;
+        }
+        if (n.second.isSpikeTimeRequired()) {
+            var_descriptor(os, model, "sT", n.first, model.getPrecision(), numNeurons * numSlots);
+            numVarDescriptors++;
+        }
+        for(const auto &v : n.second.getNonConstantVars()) {
+            var_descriptor(os, model, v.first, n.first, v.second, n.second.isVarQueueRequired(v.first) ? numNeurons * numSlots : numNeurons);
+            numVarDescriptors++;
+        }
+    }
+    for(const auto &s : model.getSynapseGroups()) {
+        const unsigned int numPre = s.second.getSrcNeuronGroup()->getNumNeurons();
+        const unsigned int numPost = s.second.getTrgNeuronGroup()->getNumNeurons();
+        var_descriptor(os, model, "inSyn", s.first, model.getPrecision(), numPost * batchSize);
+        numVarDescriptors++;
+        if (s.second.isDendriticDelayRequired()) {
+            var_descriptor(os, model, "denDelay", s.first, model.getPrecision(), numPost * s.second.getMaxDendriticDelaySteps());
+            numVarDescriptors++;
+        }
+        if (s.second.getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+            var_descriptor(os, model, "gp", s.first, "uint32_t", (numPre * numPost) / 32 + 1);
+            numVarDescriptors++;
+        }
+        else if (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            // sparse projection arrays are sized by the number of connections passed to allocate<synapse group>()
+            const string connN = "C" + s.first + ".connN";
+            // **NOTE** a size of 0 marks arrays with one element per connection
+            vector<pair<string, unsigned int>> sparseArrays{{"indInG", numPre + 1}, {"ind", 0}};
+            if (model.isSynapseGroupDynamicsRequired(s.first)) {
+                sparseArrays.emplace_back("preInd", 0);
+            }
+            if (model.isSynapseGroupPostLearningRequired(s.first)) {
+                sparseArrays.emplace_back("revIndInG", numPost + 1);
+                sparseArrays.emplace_back("revInd", 0);
+                sparseArrays.emplace_back("remap", 0);
+            }
+            for(const auto &a : sparseArrays) {
+                var_descriptor(os, model, a.first, s.first, "unsigned int", to_string((a.second == 0) ? 1 : a.second), (a.second == 0) ? connN : "",
+                               "C" + s.first + "." + a.first, "d_" + a.first + s.first);
+                numVarDescriptors++;
+            }
+        }
+        if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+            if (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                for(const auto &v : s.second.getNonConstantWUVars()) {
+                    var_descriptor(os, model, v.first, s.first, v.second, to_string(batchSize), "C" + s.first + ".connN", v.first + s.first, "d_" + v.first + s.first);
+                    numVarDescriptors++;
+                }
+            }
+            else if (s.second.getMatrixType() & SynapseMatrixConnectivity::DENSE) {
+                for(const auto &v : s.second.getNonConstantWUVars()) {
+                    var_descriptor(os, model, v.first, s.first, v.second, numPre * numPost * batchSize);
+                    numVarDescriptors++;
+                }
+            }
+            for(const auto &v : s.second.getPSModel()->getVars()) {
+                var_descriptor(os, model, v.first, s.first, v.second, numPost * batchSize);
+                numVarDescriptors++;
+            }
+        }
+    }
+    os << "};" << ENDL;
+    os << "const unsigned int numVarDescriptors = " << numVarDescriptors << ";" << ENDL;
+    os << ENDL;
+    os << "const VarDescriptor *getVarDescriptor(const char *name, const char *group)" << OB(1191);
+    os << "return findVarDescriptor(varDescriptorTable, numVarDescriptors, name, group);" << ENDL;
+    os << CB(1191) << ENDL;
+
+
     //--------------------------
     // HOST AND DEVICE FUNCTIONS
 
@@ -917,11 +1332,21 @@ void genRunner(const NNmodel &model, //!< Model description
     // include simulation kernels
 #ifndef CPU_ONLY
     os << "#include \"runnerGPU.cc\"" << ENDL << ENDL;
+
+    // the initialisation code copies to device symbols so can't be compiled separately from them
+    os << "#include \"init.cc\"" << ENDL << ENDL;
 #endif
-    os << "#include \"neuronFnct.cc\"" << ENDL;
+
+    // declare the CPU simulation functions compiled from neuronFnct.cc and synapseFnct.cc
+    os << "void calcNeuronsCPU(" << model.getPrecision() << " t);" << ENDL;
     if (!model.getSynapseGroups().empty()) {
-        os << "#include \"synapseFnct.cc\"" << ENDL;
+        os << "void calcSynapseDynamicsCPU(" << model.getPrecision() << " t);" << ENDL;
+        os << "void calcSynapsesCPU(" << model.getPrecision() << " t);" << ENDL;
+        if (!model.getSynapsePostLearnGroups().empty()) {
+            os << "void learnSynapsesPostHost(" << model.getPrecision() << " t);" << ENDL;
+        }
     }
+    os << ENDL;
 
 
     // ---------------------------------------------------------------------
@@ -979,48 +1404,54 @@ void genRunner(const NNmodel &model, //!< Model description
     }
 
     // ALLOCATE NEURON VARIABLES
+    // **NOTE** every instance of a batched model has its own state, spike counts and spikes
     for(const auto &n : model.getNeuronGroups()) {
         // Allocate population spike count
         mem += allocate_variable(os, "unsigned int", "glbSpkCnt" + n.first, n.second.isSpikeZeroCopyEnabled(),
-                                 n.second.isTrueSpikeRequired() ? n.second.getNumDelaySlots() : 1);
+                                 (n.second.isTrueSpikeRequired() ? n.second.getNumDelaySlots() : 1) * batchSize);
 
         // Allocate population spike output buffer
         mem += allocate_variable(os, "unsigned int", "glbSpk" + n.first, n.second.isSpikeZeroCopyEnabled(),
-                                 n.second.isTrueSpikeRequired() ? n.second.getNumNeurons() * n.second.getNumDelaySlots() : n.second.getNumNeurons());
+                                 (n.second.isTrueSpikeRequired() ? n.second.getNumNeurons() * n.second.getNumDelaySlots() : n.second.getNumNeurons()) * batchSize);
 
 
         if (n.second.isSpikeEventRequired()) {
             // Allocate population spike-like event counters
             mem += allocate_variable(os, "unsigned int", "glbSpkCntEvnt" + n.first, n.second.isSpikeEventZeroCopyEnabled(),
-                                     n.second.getNumDelaySlots());
+                                     n.second.getNumDelaySlots() * batchSize);
 
             // Allocate population spike-like event output buffer
             mem += allocate_variable(os, "unsigned int", "glbSpkEvnt" + n.first, n.second.isSpikeEventZeroCopyEnabled(),
-                                     n.second.getNumNeurons() * n.second.getNumDelaySlots());
+                                     n.second.getNumNeurons() * n.second.getNumDelaySlots() * batchSize);
         }
 
         // Allocate buffer to hold last spike times if required
         if (n.second.isSpikeTimeRequired()) {
             mem += allocate_variable(os, model.getPrecision(), "sT" + n.first, n.second.isSpikeTimeZeroCopyEnabled(),
-                                     n.second.getNumNeurons() * n.second.getNumDelaySlots());
+                                     n.second.getNumNeurons() * n.second.getNumDelaySlots() * batchSize);
         }
 
         // Allocate memory for neuron model's state variables
-        for(const auto &v : n.second.getNeuronModel()->getVars()) {
+        for(const auto &v : n.second.getNonConstantVars()) {
             mem += allocate_variable(os, v.second, v.first + n.first, n.second.isVarZeroCopyEnabled(v.first),
-                                     n.second.isVarQueueRequired(v.first) ? n.second.getNumNeurons() * n.second.getNumDelaySlots() : n.second.getNumNeurons());
+                                     (n.second.isVarQueueRequired(v.first) ? n.second.getNumNeurons() * n.second.getNumDelaySlots() : n.second.getNumNeurons()) * batchSize);
         }
         os << ENDL;
     }
 
     // ALLOCATE SYNAPSE VARIABLES
     for(const auto &s : model.getSynapseGroups()) {
-        const auto *wu = s.second.getWUModel();
         const auto *psm = s.second.getPSModel();
 
         // Allocate buffer to hold input coming from this synapse population
         mem += allocate_variable(os, model.getPrecision(), "inSyn" + s.first, false,
-                                 s.second.getTrgNeuronGroup()->getNumNeurons());
+                                 s.second.getTrgNeuronGroup()->getNumNeurons() * batchSize);
+
+        // Delayed input is held in one slot per time step of delay until it reaches the postsynaptic neurons
+        if (s.second.isDendriticDelayRequired()) {
+            mem += allocate_variable(os, model.getPrecision(), "denDelay" + s.first, false,
+                                     s.second.getTrgNeuronGroup()->getNumNeurons() * s.second.getMaxDendriticDelaySteps());
+        }
 
         // If connectivity is defined using a bitmask, allocate memory for bitmask
         if (s.second.getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
@@ -1031,16 +1462,16 @@ void genRunner(const NNmodel &model, //!< Model description
         // Otherwise, if matrix connectivity is defined using a dense matrix, allocate user-defined weight model variables
         // **NOTE** if matrix is sparse, allocate later in the allocatesparsearrays function when we know the size of the network
         else if ((s.second.getMatrixType() & SynapseMatrixConnectivity::DENSE) && (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)) {
-            const size_t size = s.second.getSrcNeuronGroup()->getNumNeurons() * s.second.getTrgNeuronGroup()->getNumNeurons();
+            const size_t size = s.second.getSrcNeuronGroup()->getNumNeurons() * s.second.getTrgNeuronGroup()->getNumNeurons() * batchSize;
 
-            for(const auto &v : wu->getVars()) {
+            for(const auto &v : s.second.getNonConstantWUVars()) {
                 mem += allocate_variable(os, v.second, v.first + s.first, s.second.isWUVarZeroCopyEnabled(v.first),
                                          size);
             }
         }
 
         if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) { // not needed for GLOBALG
-            const size_t size = s.second.getTrgNeuronGroup()->getNumNeurons();
+            const size_t size = s.second.getTrgNeuronGroup()->getNumNeurons() * batchSize;
 
             for(const auto &v : psm->getVars()) {
                 mem += allocate_variable(os, v.second, v.first + s.first, s.second.isPSVarZeroCopyEnabled(v.first),
@@ -1053,190 +1484,36 @@ void genRunner(const NNmodel &model, //!< Model description
 
 
     // ------------------------------------------------------------------------
-    // initializing variables
-    // write doxygen comment
-    os << "//-------------------------------------------------------------------------" << ENDL;
-    os << "/*! \\brief Function to (re)set all model variables to their compile-time, homogeneous initial values." << ENDL;
-    os << " Note that this typically includes synaptic weight values. The function (re)sets host side variables and copies them to the GPU device." << ENDL;
-    os << "*/" << ENDL;
-    os << "//-------------------------------------------------------------------------" << ENDL << ENDL;
+    // allocating conductance arrays for sparse matrices
 
-    os << "void initialize()" << ENDL;
-    os << "{" << ENDL;
+    for(const auto &s : model.getSynapseGroups()) {
+        if (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            os << "void allocate" << s.first << "(unsigned int connN)" << "{" << ENDL;
+            os << "// Allocate host side variables" << ENDL;
+            os << "  C" << s.first << ".connN= connN;" << ENDL;
 
-    // Extra braces around Windows for loops to fix https://support.microsoft.com/en-us/kb/315481
-#ifdef _WIN32
-    string oB = "{", cB = "}";
-#else
-    string oB = "", cB = "";
-#endif // _WIN32
+            // Allocate indices pointing to synapses in each presynaptic neuron's sparse matrix row
+            allocate_host_variable(os, "unsigned int", "C" + s.first + ".indInG", false,
+                                   s.second.getSrcNeuronGroup()->getNumNeurons() + 1);
 
-    if (model.getSeed() == 0) {
-        os << "    srand((unsigned int) time(NULL));" << ENDL;
-    }
-    else {
-        os << "    srand((unsigned int) " << model.getSeed() << ");" << ENDL;
-    }
-    os << ENDL;
+            // Allocate the postsynaptic neuron indices that make up sparse matrix
+            allocate_host_variable(os, "unsigned int", "C" + s.first + ".ind", false,
+                                   "connN");
 
-    // INITIALISE NEURON VARIABLES
-    os << "    // neuron variables" << ENDL;
-    for(const auto &n : model.getNeuronGroups()) {
-        if (n.second.isDelayRequired()) {
-            os << "    spkQuePtr" << n.first << " = 0;" << ENDL;
-#ifndef CPU_ONLY
-            os << "CHECK_CUDA_ERRORS(cudaMemcpyToSymbol(dd_spkQuePtr" << n.first;
-            os << ", &spkQuePtr" << n.first;
-            os << ", sizeof(unsigned int), 0, cudaMemcpyHostToDevice));" << ENDL;
-#endif
-        }
+            if (model.isSynapseGroupDynamicsRequired(s.first)) {
+                allocate_host_variable(os, "unsigned int", "C" + s.first + ".preInd", false,
+                                       "connN");
+            } else {
+                os << "  C" << s.first << ".preInd= NULL;" << ENDL;
+            }
+            if (model.isSynapseGroupPostLearningRequired(s.first)) {
+                // Allocate indices pointing to synapses in each postsynaptic neuron's sparse matrix column
+                allocate_host_variable(os, "unsigned int", "C" + s.first + ".revIndInG", false,
+                                       s.second.getTrgNeuronGroup()->getNumNeurons() + 1);
 
-        if (n.second.isTrueSpikeRequired() && n.second.isDelayRequired()) {
-            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumDelaySlots() << "; i++) {" << ENDL;
-            os << "        glbSpkCnt" << n.first << "[i] = 0;" << ENDL;
-            os << "    }" << cB << ENDL;
-            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumNeurons() * n.second.getNumDelaySlots() << "; i++) {" << ENDL;
-            os << "        glbSpk" << n.first << "[i] = 0;" << ENDL;
-            os << "    }" << cB << ENDL;
-        }
-        else {
-            os << "    glbSpkCnt" << n.first << "[0] = 0;" << ENDL;
-            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumNeurons() << "; i++) {" << ENDL;
-            os << "        glbSpk" << n.first << "[i] = 0;" << ENDL;
-            os << "    }" << cB << ENDL;
-        }
-
-        if (n.second.isSpikeEventRequired() && n.second.isDelayRequired()) {
-            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumDelaySlots() << "; i++) {" << ENDL;
-            os << "        glbSpkCntEvnt" << n.first << "[i] = 0;" << ENDL;
-            os << "    }" << cB << ENDL;
-            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumNeurons() * n.second.getNumDelaySlots() << "; i++) {" << ENDL;
-            os << "        glbSpkEvnt" << n.first << "[i] = 0;" << ENDL;
-            os << "    }" << cB << ENDL;
-        }
-        else if (n.second.isSpikeEventRequired()) {
-            os << "    glbSpkCntEvnt" << n.first << "[0] = 0;" << ENDL;
-            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumNeurons() << "; i++) {" << ENDL;
-            os << "        glbSpkEvnt" << n.first << "[i] = 0;" << ENDL;
-            os << "    }" << cB << ENDL;
-        }
-
-        if (n.second.isSpikeTimeRequired()) {
-            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumNeurons() * n.second.getNumDelaySlots() << "; i++) {" << ENDL;
-            os << "        sT" <<  n.first << "[i] = -10.0;" << ENDL;
-            os << "    }" << cB << ENDL;
-        }
-        
-        auto neuronModelVars = n.second.getNeuronModel()->getVars();
-        for (size_t j = 0; j < neuronModelVars.size(); j++) {
-            if (n.second.isVarQueueRequired(neuronModelVars[j].first)) {
-                os << "    " << oB << "for (int i = 0; i < " << n.second.getNumNeurons() * n.second.getNumDelaySlots() << "; i++) {" << ENDL;
-            }
-            else {
-                os << "    " << oB << "for (int i = 0; i < " << n.second.getNumNeurons() << "; i++) {" << ENDL;
-            }
-            if (neuronModelVars[j].second == model.getPrecision()) {
-                os << "        " << neuronModelVars[j].first << n.first << "[i] = " << model.scalarExpr(n.second.getInitVals()[j]) << ";" << ENDL;
-            }
-            else {
-                os << "        " << neuronModelVars[j].first << n.first << "[i] = " << n.second.getInitVals()[j] << ";" << ENDL;
-            }
-            os << "    }" << cB << ENDL;
-        }
-
-        if (n.second.getNeuronModel()->isPoisson()) {
-            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumNeurons() << "; i++) {" << ENDL;
-            os << "        seed" << n.first << "[i] = rand();" << ENDL;
-            os << "    }" << cB << ENDL;
-        }
-
-        /*if ((model.neuronType[i] == IZHIKEVICH) && (model.getDT() != 1.0)) {
-            os << "    fprintf(stderr,\"WARNING: You use a time step different than 1 ms. Izhikevich model behaviour may not be robust.\\n\"); " << ENDL;
-        }*/
-    }
-    os << ENDL;
-
-    // INITIALISE SYNAPSE VARIABLES
-    os << "    // synapse variables" << ENDL;
-    for(const auto &s : model.getSynapseGroups()) {
-        const auto *wu = s.second.getWUModel();
-        const auto *psm = s.second.getPSModel();
-
-        const unsigned int numSrcNeurons = s.second.getSrcNeuronGroup()->getNumNeurons();
-        const unsigned int numTrgNeurons = s.second.getTrgNeuronGroup()->getNumNeurons();
-
-        os << "    " << oB << "for (int i = 0; i < " << numTrgNeurons << "; i++) {" << ENDL;
-        os << "        inSyn" << s.first << "[i] = " << model.scalarExpr(0.0) << ";" << ENDL;
-        os << "    }" << cB << ENDL;
-
-        if ((s.second.getMatrixType() & SynapseMatrixConnectivity::DENSE) && (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)) {
-            auto wuVars = wu->getVars();
-            for (size_t k= 0, l= wuVars.size(); k < l; k++) {
-                os << "    " << oB << "for (int i = 0; i < " << numSrcNeurons * numTrgNeurons << "; i++) {" << ENDL;
-                if (wuVars[k].second == model.getPrecision()) {
-                    os << "        " << wuVars[k].first << s.first << "[i] = " << model.scalarExpr(s.second.getWUInitVals()[k]) << ";" << ENDL;
-                }
-                else {
-                    os << "        " << wuVars[k].first << s.first << "[i] = " << s.second.getWUInitVals()[k] << ";" << ENDL;
-                }
-        
-                os << "    }" << cB << ENDL;
-            }
-        }
-
-        if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-            auto psmVars = psm->getVars();
-            for (size_t k= 0, l= psmVars.size(); k < l; k++) {
-                os << "    " << oB << "for (int i = 0; i < " << numTrgNeurons << "; i++) {" << ENDL;
-                if (psmVars[k].second == model.getPrecision()) {
-                    os << "        " << psmVars[k].first << s.first << "[i] = " << model.scalarExpr(s.second.getPSInitVals()[k]) << ";" << ENDL;
-                }
-                else {
-                    os << "        " << psmVars[k].first << s.first << "[i] = " << s.second.getPSInitVals()[k] << ";" << ENDL;
-                }
-                os << "    }" << cB << ENDL;
-            }
-        }
-    }
-    os << ENDL << ENDL;
-#ifndef CPU_ONLY
-    os << "    copyStateToDevice();" << ENDL << ENDL;
-    os << "    //initializeAllSparseArrays(); //I comment this out instead of removing to keep in mind that sparse arrays need to be initialised manually by hand later" << ENDL;
-#endif
-    os << "}" << ENDL << ENDL;
-
-
-    // ------------------------------------------------------------------------
-    // allocating conductance arrays for sparse matrices
-
-    for(const auto &s : model.getSynapseGroups()) {
-        if (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-            os << "void allocate" << s.first << "(unsigned int connN)" << "{" << ENDL;
-            os << "// Allocate host side variables" << ENDL;
-            os << "  C" << s.first << ".connN= connN;" << ENDL;
-
-            // Allocate indices pointing to synapses in each presynaptic neuron's sparse matrix row
-            allocate_host_variable(os, "unsigned int", "C" + s.first + ".indInG", false,
-                                   s.second.getSrcNeuronGroup()->getNumNeurons() + 1);
-
-            // Allocate the postsynaptic neuron indices that make up sparse matrix
-            allocate_host_variable(os, "unsigned int", "C" + s.first + ".ind", false,
-                                   "connN");
-
-            if (model.isSynapseGroupDynamicsRequired(s.first)) {
-                allocate_host_variable(os, "unsigned int", "C" + s.first + ".preInd", false,
-                                       "connN");
-            } else {
-                os << "  C" << s.first << ".preInd= NULL;" << ENDL;
-            }
-            if (model.isSynapseGroupPostLearningRequired(s.first)) {
-                // Allocate indices pointing to synapses in each postsynaptic neuron's sparse matrix column
-                allocate_host_variable(os, "unsigned int", "C" + s.first + ".revIndInG", false,
-                                       s.second.getTrgNeuronGroup()->getNumNeurons() + 1);
-
-                // Allocate presynaptic neuron indices that make up postsynaptically indexed sparse matrix
-                allocate_host_variable(os, "unsigned int", "C" + s.first + ".revInd", false,
-                                       "connN");
+                // Allocate presynaptic neuron indices that make up postsynaptically indexed sparse matrix
+                allocate_host_variable(os, "unsigned int", "C" + s.first + ".revInd", false,
+                                       "connN");
 
                 // Allocate array mapping from postsynaptically to presynaptically indexed sparse matrix
                 allocate_host_variable(os, "unsigned int", "C" + s.first + ".remap", false,
@@ -1248,6 +1525,7 @@ void genRunner(const NNmodel &model, //!< Model description
             }
 
             const string numConnections = "C" + s.first + ".connN";
+            const string numSynapseVars = (model.getBatchSize() > 1) ? numConnections + " * " + to_string(model.getBatchSize()) : numConnections;
 
             allocate_device_variable(os, "unsigned int", "indInG" + s.first, false,
                                      s.second.getSrcNeuronGroup()->getNumNeurons() + 1);
@@ -1270,8 +1548,8 @@ void genRunner(const NNmodel &model, //!< Model description
 
             // Allocate synapse variables
             if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-                for(const auto &v : s.second.getWUModel()->getVars()) {
-                    allocate_variable(os, v.second, v.first + s.first, s.second.isWUVarZeroCopyEnabled(v.first), numConnections);
+                for(const auto &v : s.second.getNonConstantWUVars()) {
+                    allocate_variable(os, v.second, v.first + s.first, s.second.isWUVarZeroCopyEnabled(v.first), numSynapseVars);
                 }
             }
 
@@ -1286,79 +1564,31 @@ void genRunner(const NNmodel &model, //!< Model description
     }
 
     // ------------------------------------------------------------------------
-    // initializing sparse arrays
-
-#ifndef CPU_ONLY
-    os << "void initializeAllSparseArrays() {" << ENDL;
-    if(any_of(begin(model.getSynapseGroups()), end(model.getSynapseGroups()),
-        [](const std::pair<string, SynapseGroup> &s)
-        {
-            return (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE);
-
-        }))
-    {
-        os << "size_t size;" << ENDL;
-    }
+    // (re)allocating the spike recording buffers
 
-    for(const auto &s : model.getSynapseGroups()) {
-        if (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE){
-            os << "size = C" << s.first << ".connN;" << ENDL;
-            os << "  initializeSparseArray(C" << s.first << ",";
-            os << " d_ind" << s.first << ",";
-            os << " d_indInG" << s.first << ",";
-            os << s.second.getSrcNeuronGroup()->getNumNeurons() <<");" << ENDL;
-            if (model.isSynapseGroupDynamicsRequired(s.first)) {
-                os << "  initializeSparseArrayPreInd(C" << s.first << ",";
-                os << " d_preInd" << s.first << ");" << ENDL;
-            }
-            if (model.isSynapseGroupPostLearningRequired(s.first)) {
-                os << "  initializeSparseArrayRev(C" << s.first << ",";
-                os << "  d_revInd" << s.first << ",";
-                os << "  d_revIndInG" << s.first << ",";
-                os << "  d_remap" << s.first << ",";
-                os << s.second.getTrgNeuronGroup()->getNumNeurons() <<");" << ENDL;
-            }
-           
-            if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-                for(const auto &v : s.second.getWUModel()->getVars()) {
-                    if(!s.second.isWUVarZeroCopyEnabled(v.first)) {
-                        os << "CHECK_CUDA_ERRORS(cudaMemcpy(d_" << v.first << s.first << ", "  << v.first << s.first << ", sizeof(" << v.second << ") * size , cudaMemcpyHostToDevice));" << ENDL;
-                    }
-                }
+    if (model.spikeRecordingInUse()) {
+        os << "void allocateSpikeRecording(unsigned int numSteps)" << ENDL;
+        os << "{" << ENDL;
+        os << "    if (numSpikeRecordingSteps > 0) {" << ENDL;
+        for(const auto &n : model.getNeuronGroups()) {
+            if (n.second.isSpikeRecordingEnabled()) {
+                free_variable(os, "recordSpkCnt" + n.first, false);
+                free_variable(os, "recordSpk" + n.first, false);
             }
         }
-    }
-    os << "}" << ENDL; 
-    os << ENDL;
-#endif
-
-    // ------------------------------------------------------------------------
-    // initialization of variables, e.g. reverse sparse arrays etc. 
-    // that the user would not want to worry about
-    
-    os << "void init" << model.getName() << "()" << ENDL;
-    os << OB(1130) << ENDL;
-    bool anySparse = false;
-    for(const auto &s : model.getSynapseGroups()) {
-        if (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-            anySparse = true;
-            if (model.isSynapseGroupDynamicsRequired(s.first)) {
-                os << "createPreIndices(" << s.second.getSrcNeuronGroup()->getNumNeurons() << ", " << s.second.getTrgNeuronGroup()->getNumNeurons() << ", &C" << s.first << ");" << ENDL;
-            }
-            if (model.isSynapseGroupPostLearningRequired(s.first)) {
-                os << "createPosttoPreArray(" << s.second.getSrcNeuronGroup()->getNumNeurons() << ", " << s.second.getTrgNeuronGroup()->getNumNeurons() << ", &C" << s.first << ");" << ENDL;
+        os << "    }" << ENDL;
+        os << "    numSpikeRecordingSteps = numSteps;" << ENDL;
+        for(const auto &n : model.getNeuronGroups()) {
+            if (n.second.isSpikeRecordingEnabled()) {
+                allocate_variable(os, "unsigned int", "recordSpkCnt" + n.first, false,
+                                  "numSteps * " + to_string(batchSize));
+                allocate_variable(os, "unsigned int", "recordSpk" + n.first, false,
+                                  "numSteps * " + to_string(n.second.getNumNeurons() * batchSize));
             }
         }
+        os << "}" << ENDL << ENDL;
     }
 
-    if (anySparse) {
-#ifndef CPU_ONLY
-        os << "initializeAllSparseArrays();" << ENDL;
-#endif
-    }
-
-    os << CB(1130) << ENDL;
-
     // ------------------------------------------------------------------------
     // freeing global memory structures
 
@@ -1383,7 +1613,7 @@ void genRunner(const NNmodel &model, //!< Model description
         }
 
         // Free neuron state variables
-        for (auto const &v : n.second.getNeuronModel()->getVars()) {
+        for (auto const &v : n.second.getNonConstantVars()) {
             free_variable(os, v.first + n.first,
                           n.second.isVarZeroCopyEnabled(v.first));
         }
@@ -1392,6 +1622,9 @@ void genRunner(const NNmodel &model, //!< Model description
     // FREE SYNAPSE VARIABLES
     for(const auto &s : model.getSynapseGroups()) {
         free_variable(os, "inSyn" + s.first, false);
+        if (s.second.isDendriticDelayRequired()) {
+            free_variable(os, "denDelay" + s.first, false);
+        }
 
         if (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
             os << "    C" << s.first << ".connN= 0;" << ENDL;
@@ -1422,7 +1655,7 @@ void genRunner(const NNmodel &model, //!< Model description
             free_variable(os, "gp" + s.first, false);
         }
         if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-            for(const auto &v : s.second.getWUModel()->getVars()) {
+            for(const auto &v : s.second.getNonConstantWUVars()) {
                 free_variable(os, v.first + s.first, s.second.isWUVarZeroCopyEnabled(v.first));
             }
             for(const auto &v : s.second.getPSModel()->getVars()) {
@@ -1430,6 +1663,19 @@ void genRunner(const NNmodel &model, //!< Model description
             }
         }
     }
+
+    // FREE SPIKE RECORDING BUFFERS
+    if (model.spikeRecordingInUse()) {
+        os << "    if (numSpikeRecordingSteps > 0) {" << ENDL;
+        for(const auto &n : model.getNeuronGroups()) {
+            if (n.second.isSpikeRecordingEnabled()) {
+                free_variable(os, "recordSpkCnt" + n.first, false);
+                free_variable(os, "recordSpk" + n.first, false);
+            }
+        }
+        os << "    }" << ENDL;
+        os << "    numSpikeRecordingSteps = 0;" << ENDL;
+    }
     os << "}" << ENDL << ENDL;
 
 
@@ -1444,10 +1690,144 @@ void genRunner(const NNmodel &model, //!< Model description
     os << "}" << ENDL;
     os << ENDL;
 
+    // ------------------------------------------------------------------------
+    // per-group timing statistics
+
+    if (model.isGroupTimingEnabled()) {
+        os << "void resetGroupTiming()" << ENDL;
+        os << OB(1150);
+        os << "for (unsigned int i = 0; i < numGroupTimingStats; i++)" << OB(1151);
+        os << "groupTimingTable[i]->reset();" << ENDL;
+        os << CB(1151);
+        os << CB(1150) << ENDL;
+
+        os << "void dumpGroupTiming(const char *filename)" << ENDL;
+        os << OB(1152);
+        os << "FILE *f = fopen(filename, \"w\");" << ENDL;
+        os << "if (f == NULL)" << OB(1153);
+        os << "gennError(\"Cannot open group timing file for writing\");" << ENDL;
+        os << CB(1153);
+        os << "writeGroupTimingJSON(f, groupTimingTable, numGroupTimingStats);" << ENDL;
+        os << "fclose(f);" << ENDL;
+        os << CB(1152) << ENDL;
+    }
+
+    // ------------------------------------------------------------------------
+    // event counters
+
+    if (model.isEventCountingEnabled()) {
+        os << "void resetEventCounters()" << ENDL;
+        os << OB(1160);
+        for(const auto &n : model.getNeuronGroups()) {
+            os << "neuronCounters" << n.first << ".reset();" << ENDL;
+        }
+        for(const auto &s : model.getSynapseGroups()) {
+            os << "synapseCounters" << s.first << ".reset();" << ENDL;
+        }
+        os << CB(1160) << ENDL;
+
+        os << "unsigned long long getTotalSynapseUpdates()" << ENDL;
+        os << OB(1161);
+        os << "unsigned long long total = 0;" << ENDL;
+        for(const auto &s : model.getSynapseGroups()) {
+            os << "total += synapseCounters" << s.first << ".synapseUpdates;" << ENDL;
+        }
+        os << "return total;" << ENDL;
+        os << CB(1161) << ENDL;
+    }
+
+    // ------------------------------------------------------------------------
+    // profile combining the timing statistics and event counters of each phase of each group
+
+    if (model.isGroupTimingEnabled() && model.isEventCountingEnabled()) {
+        const map<string, string> phaseEvents = {{"neuron", "neuronCounters$(group).spikes"}, {"synapse", "synapseCounters$(group).preSpikes"},
+                                                 {"learning", "synapseCounters$(group).postLearnUpdates"}, {"synapseDynamics", "synapseCounters$(group).synDynUpdates"}};
+
+        os << "void dumpProfile(const char *filename)" << ENDL;
+        os << OB(1162);
+        os << "FILE *f = fopen(filename, \"w\");" << ENDL;
+        os << "if (f == NULL)" << OB(1163);
+        os << "gennError(\"Cannot open profile file for writing\");" << ENDL;
+        os << CB(1163);
+        os << "fprintf(f, \"# phase group updates seconds events\\n\");" << ENDL;
+        for(const auto &g : get_group_timing_stats(model)) {
+            string events = phaseEvents.at(get<2>(g));
+            substitute(events, "$(group)", get<1>(g));
+            os << "fprintf(f, \"" << get<2>(g) << " " << get<1>(g) << " %llu %.9e %llu\\n\", ";
+            os << get<0>(g) << ".count, " << get<0>(g) << ".totalSeconds, " << events << ");" << ENDL;
+        }
+        os << "fclose(f);" << ENDL;
+        os << CB(1162) << ENDL;
+    }
+
+    // ------------------------------------------------------------------------
+    // setting runtime parameters
+
+    for(const auto &r : runtimeParams) {
+        for(const auto &p : get<3>(r)) {
+            os << "void set" << p.first << get<2>(r) << "(" << model.getPrecision() << " value)" << ENDL;
+            os << OB(1171);
+            os << get<1>(r) << "." << p.first << " = value;" << ENDL;
+            os << CB(1171) << ENDL;
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // applying frames from input queues
+
+    for(const auto &n : model.getNeuronGroups()) {
+        if (n.second.isInputQueueEnabled()) {
+            const string queueOffset = n.second.getQueueOffset("");
+            const string queueOffsetTrueSpk = n.second.isTrueSpikeRequired() ? queueOffset : "";
+            const string spkCnt = "glbSpkCnt" + n.first + ((n.second.isDelayRequired() && n.second.isTrueSpikeRequired()) ? "[spkQuePtr" + n.first + "]" : "[0]");
+
+            os << "void applyInputQueue" << n.first << "()" << ENDL;
+            os << OB(1140);
+            os << "const InputQueue<scalar>::Frame *f;" << ENDL;
+            os << "while (((f = inputQueue" << n.first << ".front()) != NULL) && (f->timestep <= iT))" << OB(1141);
+            os << "if (f->type == InputQueue<scalar>::FrameType::SPIKES)" << OB(1142);
+            os << "// injected spikes are appended to the current spike output so they are propagated during this time step" << ENDL;
+            os << "for (unsigned int i = 0; i < f->count; i++)" << OB(1143);
+            os << "const unsigned int n = f->spikes[i];" << ENDL;
+            os << "if ((n < " << n.second.getNumNeurons() << ") && (" << spkCnt << " < " << n.second.getNumNeurons() << "))" << OB(1144);
+            os << "glbSpk" << n.first << "[" << queueOffsetTrueSpk << spkCnt << "++] = n;" << ENDL;
+            if (n.second.isSpikeTimeRequired()) {
+                os << "sT" << n.first << "[" << queueOffset << "n] = t - DT;" << ENDL;
+            }
+            os << CB(1144);
+            os << CB(1143);
+            os << CB(1142);
+            os << "else" << OB(1145);
+            if (n.second.isQuiescenceSkippingEnabled()) {
+                os << "quiescent" << n.first << " = false;" << ENDL;
+            }
+            os << "switch (f->target)" << OB(1146);
+            auto neuronModelVars = n.second.getNeuronModel()->getVars();
+            for (size_t j = 0; j < neuronModelVars.size(); j++) {
+                const auto &v = neuronModelVars[j];
+                os << "case " << j << ":" << ENDL;
+                os << "for (unsigned int i = 0; i < " << n.second.getNumNeurons() << "; i++)" << OB(1147);
+                os << v.first << n.first << "[" << (n.second.isVarQueueRequired(v.first) ? queueOffset : "") << "i] = (" << v.second << ") f->values[i];" << ENDL;
+                os << CB(1147);
+                os << "break;" << ENDL;
+            }
+            os << CB(1146);
+            os << CB(1145);
+            os << "inputQueue" << n.first << ".pop();" << ENDL;
+            os << CB(1141);
+            os << CB(1140) << ENDL;
+        }
+    }
+
     os << "// ------------------------------------------------------------------------" << ENDL;
     os << "// the actual time stepping procedure (using CPU)" << ENDL;
     os << "void stepTimeCPU()" << ENDL;
     os << "{" << ENDL;
+    for(const auto &n : model.getNeuronGroups()) {
+        if (n.second.isInputQueueEnabled()) {
+            os << "    applyInputQueue" << n.first << "();" << ENDL;
+        }
+    }
     if (!model.getSynapseGroups().empty()) {
         if (!model.getSynapseDynamicsGroups().empty()) {
             if (model.isTimingEnabled()) os << "        synDyn_timer.startTimer();" << ENDL;
@@ -1481,35 +1861,140 @@ void genRunner(const NNmodel &model, //!< Model description
     os << "iT++;" << ENDL;
     os << "t= iT*DT;" << ENDL;
     os << "}" << ENDL;
-    os.close();
-
-
-    // ------------------------------------------------------------------------
-    // finish up
+    os << ENDL;
 
-#ifndef CPU_ONLY
-    cout << "Global memory required for core model: " << mem/1e6 << " MB. " << ENDL;
-    cout << deviceProp[theDevice].totalGlobalMem << " for device " << theDevice << ENDL;  
-  
-    if (0.5 * deviceProp[theDevice].totalGlobalMem < mem) {
-        cout << "memory required for core model (" << mem/1e6;
-        cout << "MB) is more than 50% of global memory on the chosen device";
-        cout << "(" << deviceProp[theDevice].totalGlobalMem/1e6 << "MB)." << ENDL;
-        cout << "Experience shows that this is UNLIKELY TO WORK ... " << ENDL;
+    // Phases of the multi-step version are timed by reading the clock once at each phase boundary and
+    // accumulating into locals which are only added to the timers' totals after the last step
+    auto genPhase =
+        [&model](ofstream &os, const string &call, const string &phase)
+        {
+            os << call << ENDL;
+            if (model.isTimingEnabled()) {
+                os << "const auto " << phase << "End = std::chrono::steady_clock::now();" << ENDL;
+                os << phase << "Time += " << phase << "End - phaseStart;" << ENDL;
+                os << "phaseStart = " << phase << "End;" << ENDL;
+            }
+        };
+    vector<string> timedPhases{"neuron"};
+    if (!model.getSynapseGroups().empty()) {
+        timedPhases.push_back("synapse");
+        if (!model.getSynapseDynamicsGroups().empty()) {
+            timedPhases.push_back("synDyn");
+        }
+        if (!model.getSynapsePostLearnGroups().empty()) {
+            timedPhases.push_back("learning");
+        }
     }
-#endif
-}
-
-
-//----------------------------------------------------------------------------
-/*!
-  \brief A function to generate the code that simulates the model on the GPU
-
-  The function generates functions that will spawn kernel grids onto the GPU (but not the actual kernel code which is generated in "genNeuronKernel()" and "genSynpaseKernel()"). Generated functions include "copyGToDevice()", "copyGFromDevice()", "copyStateToDevice()", "copyStateFromDevice()", "copySpikesFromDevice()", "copySpikeNFromDevice()" and "stepTimeGPU()". The last mentioned function is the function that will initialize the execution on the GPU in the generated simulation engine. All other generated functions are "convenience functions" to handle data transfer from and to the GPU.
-*/
-//----------------------------------------------------------------------------
 
-#ifndef CPU_ONLY
+    os << "// ------------------------------------------------------------------------" << ENDL;
+    os << "// numSteps time steps of the time stepping procedure in one call (using CPU)" << ENDL;
+    os << "void stepTimeCPU(unsigned int numSteps)" << ENDL;
+    os << OB(1192);
+    if (model.spikeRecordingInUse()) {
+        os << "if (numSteps > numSpikeRecordingSteps)" << OB(1193);
+        os << "gennError(\"stepTimeCPU(numSteps) was called for more time steps than allocateSpikeRecording() allocated\");" << ENDL;
+        os << CB(1193);
+    }
+    if (model.isTimingEnabled()) {
+        for(const auto &p : timedPhases) {
+            os << "std::chrono::steady_clock::duration " << p << "Time(0);" << ENDL;
+        }
+    }
+    os << "for (unsigned int s = 0; s < numSteps; s++)" << OB(1194);
+    for(const auto &n : model.getNeuronGroups()) {
+        if (n.second.isInputQueueEnabled()) {
+            os << "applyInputQueue" << n.first << "();" << ENDL;
+        }
+    }
+    if (model.isTimingEnabled()) {
+        os << "auto phaseStart = std::chrono::steady_clock::now();" << ENDL;
+    }
+    if (!model.getSynapseGroups().empty()) {
+        if (!model.getSynapseDynamicsGroups().empty()) {
+            genPhase(os, "calcSynapseDynamicsCPU(t);", "synDyn");
+        }
+        genPhase(os, "calcSynapsesCPU(t);", "synapse");
+        if (!model.getSynapsePostLearnGroups().empty()) {
+            genPhase(os, "learnSynapsesPostHost(t);", "learning");
+        }
+    }
+    genPhase(os, "calcNeuronsCPU(t);", "neuron");
+
+    // Copy each recording group's spikes of this step into the recording buffers
+    for(const auto &n : model.getNeuronGroups()) {
+        if (n.second.isSpikeRecordingEnabled()) {
+            const unsigned int numNeurons = n.second.getNumNeurons();
+            if (batchSize == 1) {
+                os << "recordSpkCnt" << n.first << "[s] = spikeCount_" << n.first << ";" << ENDL;
+                os << "memcpy(&recordSpk" << n.first << "[s * " << numNeurons << "], spike_" << n.first;
+                os << ", spikeCount_" << n.first << " * sizeof(unsigned int));" << ENDL;
+            }
+            else {
+                os << "for (unsigned int b = 0; b < " << batchSize << "; b++)" << OB(1195);
+                os << "recordSpkCnt" << n.first << "[(s * " << batchSize << ") + b] = glbSpkCnt" << n.first << "[b];" << ENDL;
+                os << "memcpy(&recordSpk" << n.first << "[((s * " << batchSize << ") + b) * " << numNeurons << "], &glbSpk" << n.first;
+                os << "[b * " << numNeurons << "], glbSpkCnt" << n.first << "[b] * sizeof(unsigned int));" << ENDL;
+                os << CB(1195);
+            }
+        }
+    }
+    os << "iT++;" << ENDL;
+    os << "t= iT*DT;" << ENDL;
+    os << CB(1194);
+    if (model.isTimingEnabled()) {
+        for(const auto &p : timedPhases) {
+            os << p << "_tme+= std::chrono::duration<double>(" << p << "Time).count();" << ENDL;
+        }
+    }
+    os << CB(1192);
+
+    if (model.isRealTimePacingEnabled()) {
+        os << "// ------------------------------------------------------------------------" << ENDL;
+        os << "// numSteps time steps of the time stepping procedure (using CPU) paced to wall-clock time" << ENDL;
+        os << "void stepTimeRealTimeCPU(unsigned int numSteps)" << ENDL;
+        os << OB(1196);
+        os << "realTimePacer.run(numSteps, []() { stepTimeCPU(); });" << ENDL;
+        os << CB(1196) << ENDL;
+
+        os << "void dumpRealTimeStats(const char *filename)" << ENDL;
+        os << OB(1197);
+        os << "FILE *f = fopen(filename, \"w\");" << ENDL;
+        os << "if (f == NULL)" << OB(1198);
+        os << "gennError(\"Cannot open real-time statistics file for writing\");" << ENDL;
+        os << CB(1198);
+        os << "realTimePacer.writeJSON(f);" << ENDL;
+        os << "fclose(f);" << ENDL;
+        os << CB(1197) << ENDL;
+    }
+    closeGeneratedFile(os, runnerName);
+
+
+    // ------------------------------------------------------------------------
+    // finish up
+
+#ifndef CPU_ONLY
+    cout << "Global memory required for core model: " << mem/1e6 << " MB. " << ENDL;
+    cout << deviceProp[theDevice].totalGlobalMem << " for device " << theDevice << ENDL;  
+  
+    if (0.5 * deviceProp[theDevice].totalGlobalMem < mem) {
+        cout << "memory required for core model (" << mem/1e6;
+        cout << "MB) is more than 50% of global memory on the chosen device";
+        cout << "(" << deviceProp[theDevice].totalGlobalMem/1e6 << "MB)." << ENDL;
+        cout << "Experience shows that this is UNLIKELY TO WORK ... " << ENDL;
+    }
+#endif
+}
+
+
+//----------------------------------------------------------------------------
+/*!
+  \brief A function to generate the code that simulates the model on the GPU
+
+  The function generates functions that will spawn kernel grids onto the GPU (but not the actual kernel code which is generated in "genNeuronKernel()" and "genSynpaseKernel()"). Generated functions include "copyGToDevice()", "copyGFromDevice()", "copyStateToDevice()", "copyStateFromDevice()", "copySpikesFromDevice()", "copySpikeNFromDevice()" and "stepTimeGPU()". The last mentioned function is the function that will initialize the execution on the GPU in the generated simulation engine. All other generated functions are "convenience functions" to handle data transfer from and to the GPU.
+*/
+//----------------------------------------------------------------------------
+
+#ifndef CPU_ONLY
 void genRunnerGPU(const NNmodel &model, //!< Model description
                   const string &path //!< Path for code generation
     )
@@ -1518,7 +2003,7 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
 
 //    cout << "entering GenRunnerGPU" << ENDL;
     string name= path + "/" + model.getName() + "_CODE/runnerGPU.cc";
-    os.open(name.c_str());
+    openGeneratedFile(os, name);
     writeHeader(os);
 
     // write doxygen comment
@@ -1528,6 +2013,10 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
     os << "*/" << ENDL;
     os << "//-------------------------------------------------------------------------" << ENDL << ENDL;
     os << ENDL;
+    if (model.isTimingEnabled()) {
+        os << "#include <vector>" << ENDL;
+        os << ENDL;
+    }
     int version;
     cudaRuntimeGetVersion(&version); 
     if ((deviceProp[theDevice].major < 6) || (version < 8000)){
@@ -1583,7 +2072,7 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
         os << "void push" << n.first << "StateToDevice()" << ENDL;
         os << OB(1050);
 
-        for(const auto &v : n.second.getNeuronModel()->getVars()) {
+        for(const auto &v : n.second.getNonConstantVars()) {
             // only copy non-zero-copied, non-pointers. Pointers don't transport between GPU and CPU
             if (v.second.find("*") == string::npos && !n.second.isVarZeroCopyEnabled(v.first)) {
                 const size_t size = n.second.isVarQueueRequired(v.first)
@@ -1706,7 +2195,6 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
     }
     // synapse variables
     for(const auto &s : model.getSynapseGroups()) {
-        const auto *wu = s.second.getWUModel();
         const auto *psm = s.second.getPSModel();
 
         os << "void push" << s.first << "StateToDevice()" << ENDL;
@@ -1722,7 +2210,7 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
                 os << "size_t size = C" << s.first << ".connN;" << ENDL;
             }
 
-            for(const auto &v : wu->getVars()) {
+            for(const auto &v : s.second.getNonConstantWUVars()) {
                  // only copy non-pointers and non-zero-copied. Pointers don't transport between GPU and CPU
                 if (v.second.find("*") == string::npos && !s.second.isWUVarZeroCopyEnabled(v.first)) {
                     os << "CHECK_CUDA_ERRORS(cudaMemcpy(d_" << v.first << s.first;
@@ -1764,7 +2252,7 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
         os << "void pull" << n.first << "StateFromDevice()" << ENDL;
         os << OB(1050);
         
-        for(const auto &v : n.second.getNeuronModel()->getVars()) {
+        for(const auto &v : n.second.getNonConstantVars()) {
             // only copy non-zero-copied, non-pointers. Pointers don't transport between GPU and CPU
             if (v.second.find("*") == string::npos && !n.second.isVarZeroCopyEnabled(v.first)) {
                 const size_t size = n.second.isVarQueueRequired(v.first)
@@ -1894,7 +2382,6 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
 
     // synapse variables
     for(const auto &s : model.getSynapseGroups()) {
-        const auto *wu = s.second.getWUModel();
         const auto *psm = s.second.getPSModel();
 
         const unsigned int numSrcNeurons = s.second.getSrcNeuronGroup()->getNumNeurons();
@@ -1911,7 +2398,7 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
                 os << "size_t size = C" << s.first << ".connN;" << ENDL;
             }
 
-            for(const auto &v : wu->getVars()) {
+            for(const auto &v : s.second.getNonConstantWUVars()) {
                 // only copy non-pointers and non-zero-copied. Pointers don't transport between GPU and CPU
                 if (v.second.find("*") == string::npos && !s.second.isWUVarZeroCopyEnabled(v.first)) {
                     os << "CHECK_CUDA_ERRORS(cudaMemcpy(" << v.first << s.first;
@@ -2111,115 +2598,140 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
     os << CB(1126) << ENDL;
     os << ENDL;
 
-    os << "// ------------------------------------------------------------------------" << ENDL;
-    os << "// the time stepping procedure (using GPU)" << ENDL;
-    os << "void stepTimeGPU()" << ENDL;
-    os << OB(1130) << ENDL;
-
-    if (!model.getSynapseGroups().empty()) {
-        unsigned int synapseGridSz = model.getSynapseKernelGridSize();
-        os << "//model.padSumSynapseTrgN[model.synapseGrpN - 1] is " << synapseGridSz << ENDL;
-        synapseGridSz = synapseGridSz / synapseBlkSz;
-        os << "dim3 sThreads(" << synapseBlkSz << ", 1);" << ENDL;
-        os << "dim3 sGrid(" << synapseGridSz << ", 1);" << ENDL;
-        os << ENDL;
-    }
-    if (!model.getSynapsePostLearnGroups().empty()) {
-        const unsigned int learnGridSz = ceil((float)model.getSynapsePostLearnGridSize() / learnBlkSz);
-        os << "dim3 lThreads(" << learnBlkSz << ", 1);" << ENDL;
-        os << "dim3 lGrid(" << learnGridSz << ", 1);" << ENDL;
-        os << ENDL;
-    }
-
-    if (!model.getSynapseDynamicsGroups().empty()) {
-        const unsigned int synDynGridSz = ceil((float)model.getSynapseDynamicsGridSize() / synDynBlkSz);
-        os << "dim3 sDThreads(" << synDynBlkSz << ", 1);" << ENDL;
-        os << "dim3 sDGrid(" << synDynGridSz << ", 1);" << ENDL;
-        os << ENDL;
-    }
+    // Kernel launches of one time step, shared by stepTimeGPU() and stepTimeGPU(numSteps),
+    // with the timing event of each phase boundary named by event
+    auto genStepKernels =
+        [&model](ofstream &os, const function<string(const string&)> &event)
+        {
+            if (!model.getSynapseGroups().empty()) {
+                if (!model.getSynapseDynamicsGroups().empty()) {
+                    if (model.isTimingEnabled()) {
+                        os << "cudaEventRecord(" << event("synDynStart") << ");" << ENDL;
+                    }
+                    os << "calcSynapseDynamics <<< sDGrid, sDThreads >>> (";
+                    for(const auto &p : model.getSynapseDynamicsKernelParameters()) {
+                        os << p.first << ", ";
+                    }
+                    os << "t);" << ENDL;
+                    if (model.isTimingEnabled()) {
+                        os << "cudaEventRecord(" << event("synDynStop") << ");" << ENDL;
+                    }
+                }
+                if (model.isTimingEnabled()) {
+                    os << "cudaEventRecord(" << event("synapseStart") << ");" << ENDL;
+                }
+                os << "calcSynapses <<< sGrid, sThreads >>> (";
+                for(const auto &p : model.getSynapseKernelParameters()) {
+                    os << p.first << ", ";
+                }
+                os << "t);" << ENDL;
+                if (model.isTimingEnabled()) {
+                    os << "cudaEventRecord(" << event("synapseStop") << ");" << ENDL;
+                }
 
-    const unsigned int neuronGridSz = ceil((float) model.getNeuronGridSize() / neuronBlkSz);
-    os << "dim3 nThreads(" << neuronBlkSz << ", 1);" << ENDL;
-    if (neuronGridSz < (unsigned int)deviceProp[theDevice].maxGridSize[1]) {
-        os << "dim3 nGrid(" << neuronGridSz << ", 1);" << ENDL;
-    }
-    else {
-        int sqGridSize = ceil((float) sqrt((float) neuronGridSz));
-        os << "dim3 nGrid(" << sqGridSize << ","<< sqGridSize <<");" << ENDL;
-    }
-    os << ENDL;
-    if (!model.getSynapseGroups().empty()) {
-        if (!model.getSynapseDynamicsGroups().empty()) {
+                if (!model.getSynapsePostLearnGroups().empty()) {
+                    if (model.isTimingEnabled()) {
+                        os << "cudaEventRecord(" << event("learningStart") << ");" << ENDL;
+                    }
+                    os << "learnSynapsesPost <<< lGrid, lThreads >>> (";
+                    for(const auto &p : model.getSimLearnPostKernelParameters()) {
+                        os << p.first << ", ";
+                    }
+                    os << "t);" << ENDL;
+                    if (model.isTimingEnabled()) {
+                        os << "cudaEventRecord(" << event("learningStop") << ");" << ENDL;
+                    }
+                }
+            }
+            for(auto &n : model.getNeuronGroups()) {
+                if (n.second.isDelayRequired()) {
+                    os << "spkQuePtr" << n.first << " = (spkQuePtr" << n.first << " + 1) % " << n.second.getNumDelaySlots() << ";" << ENDL;
+                }
+            }
             if (model.isTimingEnabled()) {
-                os << "cudaEventRecord(synDynStart);" << ENDL;
+                os << "cudaEventRecord(" << event("neuronStart") << ");" << ENDL;
             }
-            os << "calcSynapseDynamics <<< sDGrid, sDThreads >>> (";
-            for(const auto &p : model.getSynapseDynamicsKernelParameters()) {
+
+            os << "calcNeurons <<< nGrid, nThreads >>> (";
+            for(const auto &p : model.getNeuronKernelParameters()) {
                 os << p.first << ", ";
             }
             os << "t);" << ENDL;
             if (model.isTimingEnabled()) {
-                os << "cudaEventRecord(synDynStop);" << ENDL;
+                os << "cudaEventRecord(" << event("neuronStop") << ");" << ENDL;
             }
-        }
-        if (model.isTimingEnabled()) {
-            os << "cudaEventRecord(synapseStart);" << ENDL;
-        }
-        os << "calcSynapses <<< sGrid, sThreads >>> (";
-        for(const auto &p : model.getSynapseKernelParameters()) {
-            os << p.first << ", ";
-        }
-        os << "t);" << ENDL;
-        if (model.isTimingEnabled()) {
-            os << "cudaEventRecord(synapseStop);" << ENDL;
-        }
+        };
 
-        if (!model.getSynapsePostLearnGroups().empty()) {
-            if (model.isTimingEnabled()) {
-                os << "cudaEventRecord(learningStart);" << ENDL;
+    // Adding the elapsed time between the timing events of each phase to the phase's total
+    auto genAddPhaseTimes =
+        [&model](ofstream &os, const function<string(const string&)> &event)
+        {
+            if (!model.getSynapseGroups().empty()) {
+                os << "cudaEventElapsedTime(&tmp, " << event("synapseStart") << ", " << event("synapseStop") << ");" << ENDL;
+                os << "synapse_tme+= tmp/1000.0;" << ENDL;
             }
-            os << "learnSynapsesPost <<< lGrid, lThreads >>> (";
-            for(const auto &p : model.getSimLearnPostKernelParameters()) {
-                os << p.first << ", ";
+            if (!model.getSynapsePostLearnGroups().empty()) {
+                os << "cudaEventElapsedTime(&tmp, " << event("learningStart") << ", " << event("learningStop") << ");" << ENDL;
+                os << "learning_tme+= tmp/1000.0;" << ENDL;
             }
-            os << "t);" << ENDL;
-            if (model.isTimingEnabled()) {
-                os << "cudaEventRecord(learningStop);" << ENDL;
+            if (!model.getSynapseDynamicsGroups().empty()) {
+                os << "cudaEventElapsedTime(&tmp, " << event("synDynStart") << ", " << event("synDynStop") << ");" << ENDL;
+                os << "synDyn_tme+= tmp/1000.0;" << ENDL;
             }
-        }
-    }    
-    for(auto &n : model.getNeuronGroups()) {
-        if (n.second.isDelayRequired()) {
-            os << "spkQuePtr" << n.first << " = (spkQuePtr" << n.first << " + 1) % " << n.second.getNumDelaySlots() << ";" << ENDL;
-        }
-    }
-    if (model.isTimingEnabled()) {
-        os << "cudaEventRecord(neuronStart);" << ENDL;
-    }
+            os << "cudaEventElapsedTime(&tmp, " << event("neuronStart") << ", " << event("neuronStop") << ");" << ENDL;
+            os << "neuron_tme+= tmp/1000.0;" << ENDL;
+        };
 
-    os << "calcNeurons <<< nGrid, nThreads >>> (";
-    for(const auto &p : model.getNeuronKernelParameters()) {
-        os << p.first << ", ";
-    }
-    os << "t);" << ENDL;
+    // Grid and block sizes of the kernels, also shared by both stepping functions
+    auto genLaunchDims =
+        [&model](ofstream &os)
+        {
+            if (!model.getSynapseGroups().empty()) {
+                unsigned int synapseGridSz = model.getSynapseKernelGridSize();
+                os << "//model.padSumSynapseTrgN[model.synapseGrpN - 1] is " << synapseGridSz << ENDL;
+                synapseGridSz = synapseGridSz / synapseBlkSz;
+                os << "dim3 sThreads(" << synapseBlkSz << ", 1);" << ENDL;
+                os << "dim3 sGrid(" << synapseGridSz << ", 1);" << ENDL;
+                os << ENDL;
+            }
+            if (!model.getSynapsePostLearnGroups().empty()) {
+                const unsigned int learnGridSz = ceil((float)model.getSynapsePostLearnGridSize() / learnBlkSz);
+                os << "dim3 lThreads(" << learnBlkSz << ", 1);" << ENDL;
+                os << "dim3 lGrid(" << learnGridSz << ", 1);" << ENDL;
+                os << ENDL;
+            }
+
+            if (!model.getSynapseDynamicsGroups().empty()) {
+                const unsigned int synDynGridSz = ceil((float)model.getSynapseDynamicsGridSize() / synDynBlkSz);
+                os << "dim3 sDThreads(" << synDynBlkSz << ", 1);" << ENDL;
+                os << "dim3 sDGrid(" << synDynGridSz << ", 1);" << ENDL;
+                os << ENDL;
+            }
+
+            const unsigned int neuronGridSz = ceil((float) model.getNeuronGridSize() / neuronBlkSz);
+            os << "dim3 nThreads(" << neuronBlkSz << ", 1);" << ENDL;
+            if (neuronGridSz < (unsigned int)deviceProp[theDevice].maxGridSize[1]) {
+                os << "dim3 nGrid(" << neuronGridSz << ", 1);" << ENDL;
+            }
+            else {
+                int sqGridSize = ceil((float) sqrt((float) neuronGridSz));
+                os << "dim3 nGrid(" << sqGridSize << ","<< sqGridSize <<");" << ENDL;
+            }
+            os << ENDL;
+        };
+
+    const auto singleStepEvent = [](const string &name){ return name; };
+
+    os << "// ------------------------------------------------------------------------" << ENDL;
+    os << "// the time stepping procedure (using GPU)" << ENDL;
+    os << "void stepTimeGPU()" << ENDL;
+    os << OB(1130) << ENDL;
+    genLaunchDims(os);
+    genStepKernels(os, singleStepEvent);
     if (model.isTimingEnabled()) {
-        os << "cudaEventRecord(neuronStop);" << ENDL;
         os << "cudaEventSynchronize(neuronStop);" << ENDL;
         os << "float tmp;" << ENDL;
-        if (!model.getSynapseGroups().empty()) {
-            os << "cudaEventElapsedTime(&tmp, synapseStart, synapseStop);" << ENDL;
-            os << "synapse_tme+= tmp/1000.0;" << ENDL;
-        }
-        if (!model.getSynapsePostLearnGroups().empty()) {
-            os << "cudaEventElapsedTime(&tmp, learningStart, learningStop);" << ENDL;
-            os << "learning_tme+= tmp/1000.0;" << ENDL;
-        }
-        if (!model.getSynapseDynamicsGroups().empty()) {
-            os << "cudaEventElapsedTime(&tmp, synDynStart, synDynStop);" << ENDL;
-            os << "lsynDyn_tme+= tmp/1000.0;" << ENDL;
-        }
-        os << "cudaEventElapsedTime(&tmp, neuronStart, neuronStop);" << ENDL;
-        os << "neuron_tme+= tmp/1000.0;" << ENDL;
+        genAddPhaseTimes(os, singleStepEvent);
     }
 
     // Synchronise if zero-copy is in use
@@ -2230,7 +2742,83 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
     os << "iT++;" << ENDL;
     os << "t= iT*DT;" << ENDL;
     os << CB(1130) << ENDL;
-    os.close();
+
+    // Each step of stepTimeGPU(numSteps) records its timing events into its own slice of a pool of events
+    const vector<string> stepTimingEventNames{"synDynStart", "synDynStop", "synapseStart", "synapseStop",
+                                              "learningStart", "learningStop", "neuronStart", "neuronStop"};
+    const auto multiStepEvent =
+        [&stepTimingEventNames](const string &name)
+        {
+            const size_t index = distance(stepTimingEventNames.cbegin(), find(stepTimingEventNames.cbegin(), stepTimingEventNames.cend(), name));
+            return "stepTimingEvents[(s * " + to_string(stepTimingEventNames.size()) + ") + " + to_string(index) + "]";
+        };
+
+    os << "// ------------------------------------------------------------------------" << ENDL;
+    os << "// the time stepping procedure for numSteps time steps (using GPU)" << ENDL;
+    os << "// kernels of successive steps are queued without waiting for each other and" << ENDL;
+    os << "// the host only synchronises with the device once, after the last step" << ENDL;
+    os << "void stepTimeGPU(unsigned int numSteps)" << ENDL;
+    os << OB(1131) << ENDL;
+    if (model.spikeRecordingInUse()) {
+        os << "if (numSteps > numSpikeRecordingSteps)" << OB(1132);
+        os << "gennError(\"stepTimeGPU(numSteps) was called for more time steps than allocateSpikeRecording() allocated\");" << ENDL;
+        os << CB(1132);
+    }
+    if (model.isTimingEnabled()) {
+        os << "// pool of timing events, grown on demand and kept for later calls" << ENDL;
+        os << "static std::vector<cudaEvent_t> stepTimingEvents;" << ENDL;
+        os << "while (stepTimingEvents.size() < (numSteps * " << stepTimingEventNames.size() << "))" << OB(1133);
+        os << "cudaEvent_t event;" << ENDL;
+        os << "CHECK_CUDA_ERRORS(cudaEventCreate(&event));" << ENDL;
+        os << "stepTimingEvents.push_back(event);" << ENDL;
+        os << CB(1133);
+    }
+    genLaunchDims(os);
+    os << "for (unsigned int s = 0; s < numSteps; s++)" << OB(1134);
+    genStepKernels(os, multiStepEvent);
+    for(const auto &n : model.getNeuronGroups()) {
+        if (n.second.isSpikeRecordingEnabled()) {
+            const bool delaySpikes = (n.second.isDelayRequired() && n.second.isTrueSpikeRequired());
+            const unsigned int numNeurons = n.second.getNumNeurons();
+            const unsigned int batchSize = model.getBatchSize();
+
+            // **NOTE** the number of spikes is not known on the host so the whole spike buffer is copied
+            os << "CHECK_CUDA_ERRORS(cudaMemcpyAsync(d_recordSpkCnt" << n.first << " + (s * " << batchSize << "), d_glbSpkCnt" << n.first;
+            os << (delaySpikes ? " + spkQuePtr" + n.first : "") << ", " << batchSize << " * sizeof(unsigned int), cudaMemcpyDeviceToDevice));" << ENDL;
+            os << "CHECK_CUDA_ERRORS(cudaMemcpyAsync(d_recordSpk" << n.first << " + (s * " << numNeurons * batchSize << "), d_glbSpk" << n.first;
+            os << (delaySpikes ? " + (spkQuePtr" + n.first + " * " + to_string(numNeurons) + ")" : "") << ", " << numNeurons * batchSize << " * sizeof(unsigned int), cudaMemcpyDeviceToDevice));" << ENDL;
+        }
+    }
+    os << "iT++;" << ENDL;
+    os << "t= iT*DT;" << ENDL;
+    os << CB(1134);
+
+    if (model.isTimingEnabled()) {
+        os << "if (numSteps > 0)" << OB(1135);
+        os << "cudaEventSynchronize(stepTimingEvents[(numSteps * " << stepTimingEventNames.size() << ") - 1]);" << ENDL;
+        os << "float tmp;" << ENDL;
+        os << "for (unsigned int s = 0; s < numSteps; s++)" << OB(1136);
+        genAddPhaseTimes(os, multiStepEvent);
+        os << CB(1136);
+        os << CB(1135);
+    }
+
+    // Copying the recorded spikes to the host waits for the last step to complete
+    for(const auto &n : model.getNeuronGroups()) {
+        if (n.second.isSpikeRecordingEnabled()) {
+            const unsigned int numNeurons = n.second.getNumNeurons();
+            const unsigned int batchSize = model.getBatchSize();
+            os << "CHECK_CUDA_ERRORS(cudaMemcpy(recordSpkCnt" << n.first << ", d_recordSpkCnt" << n.first << ", numSteps * " << batchSize << " * sizeof(unsigned int), cudaMemcpyDeviceToHost));" << ENDL;
+            os << "CHECK_CUDA_ERRORS(cudaMemcpy(recordSpk" << n.first << ", d_recordSpk" << n.first << ", numSteps * " << numNeurons * batchSize << " * sizeof(unsigned int), cudaMemcpyDeviceToHost));" << ENDL;
+        }
+    }
+
+    // Synchronise if zero-copy is in use
+    if(model.zeroCopyInUse()) {
+        os << "cudaDeviceSynchronize();" << ENDL;
+    }
+    os << CB(1131) << ENDL;
+    closeGeneratedFile(os, name);
     //cout << "done with generating GPU runner" << ENDL;
 }
 #endif // CPU_ONLY
@@ -2238,105 +2826,631 @@ void genRunnerGPU(const NNmodel &model, //!< Model description
 
 //----------------------------------------------------------------------------
 /*!
-  \brief A function that generates the Makefile for all generated GeNN code.
+  \brief A function that generates init.cc containing the code which initialises the model variables and sparse connectivity.
 */
 //----------------------------------------------------------------------------
 
-void genMakefile(const NNmodel &model, //!< Model description
-                 const string &path    //!< Path for code generation
-                 )
+void genInit(const NNmodel &model, //!< Model description
+             const string &path    //!< Path for code generation
+             )
 {
-    string name = path + "/" + model.getName() + "_CODE/Makefile";
+    string name = path + "/" + model.getName() + "_CODE/init.cc";
     ofstream os;
-    os.open(name.c_str());
-
-#ifdef _WIN32
-
-#ifdef CPU_ONLY
-    string cxxFlags = "/c /DCPU_ONLY";
-    cxxFlags += " " + GENN_PREFERENCES::userCxxFlagsWIN;
-    if (GENN_PREFERENCES::optimizeCode) cxxFlags += " /O2";
-    if (GENN_PREFERENCES::debugCode) cxxFlags += " /debug /Zi /Od";
+    openGeneratedFile(os, name);
+    writeHeader(os);
+    os << ENDL;
 
-    os << endl;
-    os << "CXXFLAGS       =/nologo /EHsc " << cxxFlags << endl;
-    os << endl;
-    os << "INCLUDEFLAGS   =/I\"$(GENN_PATH)\\lib\\include\"" << endl;
-    os << endl;
-    os << "all: runner.obj" << endl;
-    os << endl;
-    os << "runner.obj: runner.cc" << endl;
-    os << "\t$(CXX) $(CXXFLAGS) $(INCLUDEFLAGS) runner.cc" << endl;
-    os << endl;
-    os << "clean:" << endl;
-    os << "\t-del runner.obj 2>nul" << endl;
-#else
-    string nvccFlags = "-c -x cu -arch sm_";
-    nvccFlags += to_string(deviceProp[theDevice].major) + to_string(deviceProp[theDevice].minor);
-    nvccFlags += " " + GENN_PREFERENCES::userNvccFlags;
-    if (GENN_PREFERENCES::optimizeCode) nvccFlags += " -O3 -use_fast_math";
-    if (GENN_PREFERENCES::debugCode) nvccFlags += " -O0 -g -G";
-    if (GENN_PREFERENCES::showPtxInfo) nvccFlags += " -Xptxas \"-v\"";
+    // write doxygen comment
+    os << "//-------------------------------------------------------------------------" << ENDL;
+    os << "/*! \\file init.cc" << ENDL << ENDL;
+    os << "\\brief File generated from GeNN for the model " << model.getName() << " containing the initialisation of model variables and sparse connectivity." << ENDL;
+    os << "*/" << ENDL;
+    os << "//-------------------------------------------------------------------------" << ENDL;
+    os << ENDL;
 
-    os << endl;
-    os << "NVCC           =\"" << NVCC << "\"" << endl;
-    os << "NVCCFLAGS      =" << nvccFlags << endl;
-    os << endl;
-    os << "INCLUDEFLAGS   =-I\"$(GENN_PATH)\\lib\\include\"" << endl;
-    os << endl;
-    os << "all: runner.obj" << endl;
-    os << endl;
-    os << "runner.obj: runner.cc" << endl;
-    os << "\t$(NVCC) $(NVCCFLAGS) $(INCLUDEFLAGS) runner.cc" << endl;
-    os << endl;
-    os << "clean:" << endl;
-    os << "\t-del runner.obj 2>nul" << endl;
-#endif
+    os << "#include \"definitions.h\"" << ENDL;
+    os << "#include <cstdlib>" << ENDL;
+    os << "#include <ctime>" << ENDL;
+    os << ENDL;
 
-#else // UNIX
+    // ------------------------------------------------------------------------
+    // initializing variables
+    // write doxygen comment
+    os << "//-------------------------------------------------------------------------" << ENDL;
+    os << "/*! \\brief Function to (re)set all model variables to their compile-time, homogeneous initial values." << ENDL;
+    os << " Note that this typically includes synaptic weight values. The function (re)sets host side variables and copies them to the GPU device." << ENDL;
+    os << "*/" << ENDL;
+    os << "//-------------------------------------------------------------------------" << ENDL << ENDL;
 
-#ifdef CPU_ONLY
-    string cxxFlags = "-c -DCPU_ONLY";
-    cxxFlags += " " + GENN_PREFERENCES::userCxxFlagsGNU;
-    if (GENN_PREFERENCES::optimizeCode) cxxFlags += " -O3 -ffast-math";
-    if (GENN_PREFERENCES::debugCode) cxxFlags += " -O0 -g";
+    os << "void initialize()" << ENDL;
+    os << "{" << ENDL;
 
-    os << endl;
-    os << "CXXFLAGS       :=" << cxxFlags << endl;
-    os << endl;
-    os << "INCLUDEFLAGS   =-I\"$(GENN_PATH)/lib/include\"" << endl;
-    os << endl;
-    os << "all: runner.o" << endl;
-    os << endl;
-    os << "runner.o: runner.cc" << endl;
-    os << "\t$(CXX) $(CXXFLAGS) $(INCLUDEFLAGS) runner.cc" << endl;
-    os << endl;
-    os << "clean:" << endl;
-    os << "\trm -f runner.o" << endl;
+    // Extra braces around Windows for loops to fix https://support.microsoft.com/en-us/kb/315481
+#ifdef _WIN32
+    string oB = "{", cB = "}";
 #else
-    string nvccFlags = "-c -x cu -arch sm_";
-    nvccFlags += to_string(deviceProp[theDevice].major) + to_string(deviceProp[theDevice].minor);
-    nvccFlags += " " + GENN_PREFERENCES::userNvccFlags;
-    if (GENN_PREFERENCES::optimizeCode) nvccFlags += " -O3 -use_fast_math -Xcompiler \"-ffast-math\"";
-    if (GENN_PREFERENCES::debugCode) nvccFlags += " -O0 -g -G";
-    if (GENN_PREFERENCES::showPtxInfo) nvccFlags += " -Xptxas \"-v\"";
+    string oB = "", cB = "";
+#endif // _WIN32
 
+    if (model.getSeed() == 0) {
+        os << "    srand((unsigned int) time(NULL));" << ENDL;
+    }
+    else {
+        os << "    srand((unsigned int) " << model.getSeed() << ");" << ENDL;
+    }
+    os << ENDL;
+
+    // INITIALISE NEURON VARIABLES
+    // **NOTE** batched models have no delay slots and every instance starts from the same initial values
+    const unsigned int batchSize = model.getBatchSize();
+    os << "    // neuron variables" << ENDL;
+    for(const auto &n : model.getNeuronGroups()) {
+        const unsigned int numNeurons = n.second.getNumNeurons() * batchSize;
+        if (n.second.isDelayRequired()) {
+            os << "    spkQuePtr" << n.first << " = 0;" << ENDL;
+#ifndef CPU_ONLY
+            os << "CHECK_CUDA_ERRORS(cudaMemcpyToSymbol(dd_spkQuePtr" << n.first;
+            os << ", &spkQuePtr" << n.first;
+            os << ", sizeof(unsigned int), 0, cudaMemcpyHostToDevice));" << ENDL;
+#endif
+        }
+        if (n.second.isQuiescenceSkippingEnabled()) {
+            os << "    quiescent" << n.first << " = false;" << ENDL;
+        }
+
+        if (n.second.isTrueSpikeRequired() && n.second.isDelayRequired()) {
+            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumDelaySlots() << "; i++) {" << ENDL;
+            os << "        glbSpkCnt" << n.first << "[i] = 0;" << ENDL;
+            os << "    }" << cB << ENDL;
+            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumNeurons() * n.second.getNumDelaySlots() << "; i++) {" << ENDL;
+            os << "        glbSpk" << n.first << "[i] = 0;" << ENDL;
+            os << "    }" << cB << ENDL;
+        }
+        else if (batchSize > 1) {
+            os << "    " << oB << "for (int i = 0; i < " << batchSize << "; i++) {" << ENDL;
+            os << "        glbSpkCnt" << n.first << "[i] = 0;" << ENDL;
+            os << "    }" << cB << ENDL;
+            os << "    " << oB << "for (int i = 0; i < " << numNeurons << "; i++) {" << ENDL;
+            os << "        glbSpk" << n.first << "[i] = 0;" << ENDL;
+            os << "    }" << cB << ENDL;
+        }
+        else {
+            os << "    glbSpkCnt" << n.first << "[0] = 0;" << ENDL;
+            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumNeurons() << "; i++) {" << ENDL;
+            os << "        glbSpk" << n.first << "[i] = 0;" << ENDL;
+            os << "    }" << cB << ENDL;
+        }
+
+        if (n.second.isSpikeEventRequired() && n.second.isDelayRequired()) {
+            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumDelaySlots() << "; i++) {" << ENDL;
+            os << "        glbSpkCntEvnt" << n.first << "[i] = 0;" << ENDL;
+            os << "    }" << cB << ENDL;
+            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumNeurons() * n.second.getNumDelaySlots() << "; i++) {" << ENDL;
+            os << "        glbSpkEvnt" << n.first << "[i] = 0;" << ENDL;
+            os << "    }" << cB << ENDL;
+        }
+        else if (n.second.isSpikeEventRequired() && batchSize > 1) {
+            os << "    " << oB << "for (int i = 0; i < " << batchSize << "; i++) {" << ENDL;
+            os << "        glbSpkCntEvnt" << n.first << "[i] = 0;" << ENDL;
+            os << "    }" << cB << ENDL;
+            os << "    " << oB << "for (int i = 0; i < " << numNeurons << "; i++) {" << ENDL;
+            os << "        glbSpkEvnt" << n.first << "[i] = 0;" << ENDL;
+            os << "    }" << cB << ENDL;
+        }
+        else if (n.second.isSpikeEventRequired()) {
+            os << "    glbSpkCntEvnt" << n.first << "[0] = 0;" << ENDL;
+            os << "    " << oB << "for (int i = 0; i < " << n.second.getNumNeurons() << "; i++) {" << ENDL;
+            os << "        glbSpkEvnt" << n.first << "[i] = 0;" << ENDL;
+            os << "    }" << cB << ENDL;
+        }
+
+        if (n.second.isSpikeTimeRequired()) {
+            os << "    " << oB << "for (int i = 0; i < " << numNeurons * n.second.getNumDelaySlots() << "; i++) {" << ENDL;
+            os << "        sT" <<  n.first << "[i] = -10.0;" << ENDL;
+            os << "    }" << cB << ENDL;
+        }
+        
+        auto neuronModelVars = n.second.getNeuronModel()->getVars();
+        for (size_t j = 0; j < neuronModelVars.size(); j++) {
+            if (n.second.isVarConstant(neuronModelVars[j].first)) {
+                continue;
+            }
+            else if (n.second.isVarQueueRequired(neuronModelVars[j].first)) {
+                os << "    " << oB << "for (int i = 0; i < " << n.second.getNumNeurons() * n.second.getNumDelaySlots() << "; i++) {" << ENDL;
+            }
+            else {
+                os << "    " << oB << "for (int i = 0; i < " << numNeurons << "; i++) {" << ENDL;
+            }
+            if (neuronModelVars[j].second == model.getPrecision()) {
+                os << "        " << neuronModelVars[j].first << n.first << "[i] = " << model.scalarExpr(n.second.getInitVals()[j]) << ";" << ENDL;
+            }
+            else {
+                os << "        " << neuronModelVars[j].first << n.first << "[i] = " << n.second.getInitVals()[j] << ";" << ENDL;
+            }
+            os << "    }" << cB << ENDL;
+        }
+
+        if (n.second.getNeuronModel()->isPoisson()) {
+            os << "    " << oB << "for (int i = 0; i < " << numNeurons << "; i++) {" << ENDL;
+            os << "        seed" << n.first << "[i] = rand();" << ENDL;
+            os << "    }" << cB << ENDL;
+        }
+
+        /*if ((model.neuronType[i] == IZHIKEVICH) && (model.getDT() != 1.0)) {
+            os << "    fprintf(stderr,\"WARNING: You use a time step different than 1 ms. Izhikevich model behaviour may not be robust.\\n\"); " << ENDL;
+        }*/
+    }
+    os << ENDL;
+
+    // INITIALISE SYNAPSE VARIABLES
+    os << "    // synapse variables" << ENDL;
+    for(const auto &s : model.getSynapseGroups()) {
+        const auto *wu = s.second.getWUModel();
+        const auto *psm = s.second.getPSModel();
+
+        const unsigned int numSrcNeurons = s.second.getSrcNeuronGroup()->getNumNeurons();
+        const unsigned int numTrgNeurons = s.second.getTrgNeuronGroup()->getNumNeurons();
+
+        os << "    " << oB << "for (int i = 0; i < " << numTrgNeurons * batchSize << "; i++) {" << ENDL;
+        os << "        inSyn" << s.first << "[i] = " << model.scalarExpr(0.0) << ";" << ENDL;
+        os << "    }" << cB << ENDL;
+        if (s.second.isPSLazyDecayEnabled()) {
+            os << "    inSynScale" << s.first << " = " << model.scalarExpr(1.0) << ";" << ENDL;
+        }
+        if (s.second.isDendriticDelayRequired()) {
+            os << "    denDelayPtr" << s.first << " = 0;" << ENDL;
+            os << "    " << oB << "for (int i = 0; i < " << numTrgNeurons * s.second.getMaxDendriticDelaySteps() << "; i++) {" << ENDL;
+            os << "        denDelay" << s.first << "[i] = " << model.scalarExpr(0.0) << ";" << ENDL;
+            os << "    }" << cB << ENDL;
+        }
+
+        if ((s.second.getMatrixType() & SynapseMatrixConnectivity::DENSE) && (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)) {
+            auto wuVars = wu->getVars();
+            for (size_t k= 0, l= wuVars.size(); k < l; k++) {
+                if (s.second.isWUVarConstant(wuVars[k].first)) {
+                    continue;
+                }
+                os << "    " << oB << "for (int i = 0; i < " << numSrcNeurons * numTrgNeurons * batchSize << "; i++) {" << ENDL;
+                if (wuVars[k].second == model.getPrecision()) {
+                    os << "        " << wuVars[k].first << s.first << "[i] = " << model.scalarExpr(s.second.getWUInitVals()[k]) << ";" << ENDL;
+                }
+                else {
+                    os << "        " << wuVars[k].first << s.first << "[i] = " << s.second.getWUInitVals()[k] << ";" << ENDL;
+                }
+        
+                os << "    }" << cB << ENDL;
+            }
+        }
+
+        if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+            auto psmVars = psm->getVars();
+            for (size_t k= 0, l= psmVars.size(); k < l; k++) {
+                os << "    " << oB << "for (int i = 0; i < " << numTrgNeurons * batchSize << "; i++) {" << ENDL;
+                if (psmVars[k].second == model.getPrecision()) {
+                    os << "        " << psmVars[k].first << s.first << "[i] = " << model.scalarExpr(s.second.getPSInitVals()[k]) << ";" << ENDL;
+                }
+                else {
+                    os << "        " << psmVars[k].first << s.first << "[i] = " << s.second.getPSInitVals()[k] << ";" << ENDL;
+                }
+                os << "    }" << cB << ENDL;
+            }
+        }
+    }
+    os << ENDL << ENDL;
+#ifndef CPU_ONLY
+    os << "    copyStateToDevice();" << ENDL << ENDL;
+    os << "    //initializeAllSparseArrays(); //I comment this out instead of removing to keep in mind that sparse arrays need to be initialised manually by hand later" << ENDL;
+#endif
+    os << "}" << ENDL << ENDL;
+
+
+    // ------------------------------------------------------------------------
+    // initializing sparse arrays
+
+#ifndef CPU_ONLY
+    os << "void initializeAllSparseArrays() {" << ENDL;
+    if(any_of(begin(model.getSynapseGroups()), end(model.getSynapseGroups()),
+        [](const std::pair<string, SynapseGroup> &s)
+        {
+            return (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE);
+
+        }))
+    {
+        os << "size_t size;" << ENDL;
+    }
+
+    for(const auto &s : model.getSynapseGroups()) {
+        if (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE){
+            os << "size = C" << s.first << ".connN;" << ENDL;
+            os << "  initializeSparseArray(C" << s.first << ",";
+            os << " d_ind" << s.first << ",";
+            os << " d_indInG" << s.first << ",";
+            os << s.second.getSrcNeuronGroup()->getNumNeurons() <<");" << ENDL;
+            if (model.isSynapseGroupDynamicsRequired(s.first)) {
+                os << "  initializeSparseArrayPreInd(C" << s.first << ",";
+                os << " d_preInd" << s.first << ");" << ENDL;
+            }
+            if (model.isSynapseGroupPostLearningRequired(s.first)) {
+                os << "  initializeSparseArrayRev(C" << s.first << ",";
+                os << "  d_revInd" << s.first << ",";
+                os << "  d_revIndInG" << s.first << ",";
+                os << "  d_remap" << s.first << ",";
+                os << s.second.getTrgNeuronGroup()->getNumNeurons() <<");" << ENDL;
+            }
+           
+            if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+                for(const auto &v : s.second.getNonConstantWUVars()) {
+                    if(!s.second.isWUVarZeroCopyEnabled(v.first)) {
+                        os << "CHECK_CUDA_ERRORS(cudaMemcpy(d_" << v.first << s.first << ", "  << v.first << s.first << ", sizeof(" << v.second << ") * size , cudaMemcpyHostToDevice));" << ENDL;
+                    }
+                }
+            }
+        }
+    }
+    os << "}" << ENDL; 
+    os << ENDL;
+#endif
+
+    // ------------------------------------------------------------------------
+    // initialization of variables, e.g. reverse sparse arrays etc. 
+    // that the user would not want to worry about
+    
+    os << "void init" << model.getName() << "()" << ENDL;
+    os << OB(1130) << ENDL;
+    bool anySparse = false;
+    for(const auto &s : model.getSynapseGroups()) {
+        if (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            anySparse = true;
+            if (model.isSynapseGroupDynamicsRequired(s.first)) {
+                os << "createPreIndices(" << s.second.getSrcNeuronGroup()->getNumNeurons() << ", " << s.second.getTrgNeuronGroup()->getNumNeurons() << ", &C" << s.first << ");" << ENDL;
+            }
+            if (model.isSynapseGroupPostLearningRequired(s.first)) {
+                os << "createPosttoPreArray(" << s.second.getSrcNeuronGroup()->getNumNeurons() << ", " << s.second.getTrgNeuronGroup()->getNumNeurons() << ", &C" << s.first << ");" << ENDL;
+            }
+        }
+    }
+
+    if (anySparse) {
+#ifndef CPU_ONLY
+        os << "initializeAllSparseArrays();" << ENDL;
+#endif
+    }
+
+    os << CB(1130) << ENDL;
+
+    closeGeneratedFile(os, name);
+}
+
+
+//----------------------------------------------------------------------------
+/*!
+  \brief A function that generates sharedLibrary.cc containing the C interface exported when the model is built as a shared library.
+
+  Only generated if GENN_PREFERENCES::buildSharedLibrary is set. All other generated code is compiled with hidden visibility so the genn_ prefixed functions defined here are the only symbols exported by the library (see SharedLibraryModel).
+*/
+//----------------------------------------------------------------------------
+
+void genSharedLibrary(const NNmodel &model, //!< Model description
+                      const string &path    //!< Path for code generation
+                      )
+{
+    string name = path + "/" + model.getName() + "_CODE/sharedLibrary.cc";
+    ofstream os;
+    openGeneratedFile(os, name);
+    writeHeader(os);
+    os << ENDL;
+
+    // write doxygen comment
+    os << "//-------------------------------------------------------------------------" << ENDL;
+    os << "/*! \\file sharedLibrary.cc" << ENDL << ENDL;
+    os << "\\brief File generated from GeNN for the model " << model.getName() << " containing the C interface exported by the shared library." << ENDL;
+    os << "*/" << ENDL;
+    os << "//-------------------------------------------------------------------------" << ENDL;
+    os << ENDL;
+
+    os << "#include \"definitions.h\"" << ENDL;
+    os << "#include \"sharedLibraryModel.h\"" << ENDL;
+    os << "#include <cstring>" << ENDL;
+    os << ENDL;
+    os << "#define GENN_EXPORT extern \"C\" __attribute__((visibility(\"default\")))" << ENDL;
+    os << ENDL;
+
+    os << "GENN_EXPORT unsigned int genn_getABIVersion(){ return GENN_SHARED_LIBRARY_ABI_VERSION; }" << ENDL;
+    os << "GENN_EXPORT const char *genn_getModelName(){ return \"" << model.getName() << "\"; }" << ENDL;
+    os << ENDL;
+    os << "GENN_EXPORT void genn_allocateMem(){ allocateMem(); }" << ENDL;
+    os << "GENN_EXPORT void genn_initialize(){ initialize(); }" << ENDL;
+    os << "GENN_EXPORT void genn_initModel(){ init" << model.getName() << "(); }" << ENDL;
+    os << "GENN_EXPORT void genn_stepTimeCPU(){ stepTimeCPU(); }" << ENDL;
+    os << "GENN_EXPORT void genn_stepTimeCPUSteps(unsigned int numSteps){ stepTimeCPU(numSteps); }" << ENDL;
+#ifndef CPU_ONLY
+    os << "GENN_EXPORT void genn_stepTimeGPU(){ stepTimeGPU(); }" << ENDL;
+    os << "GENN_EXPORT void genn_stepTimeGPUSteps(unsigned int numSteps){ stepTimeGPU(numSteps); }" << ENDL;
+    os << "GENN_EXPORT void genn_copyStateToDevice(){ copyStateToDevice(); }" << ENDL;
+    os << "GENN_EXPORT void genn_copyStateFromDevice(){ copyStateFromDevice(); }" << ENDL;
+#endif
+    os << "GENN_EXPORT void genn_freeMem(){ freeMem(); }" << ENDL;
+    os << ENDL;
+    os << "GENN_EXPORT unsigned long long genn_getTimestep(){ return iT; }" << ENDL;
+    os << "GENN_EXPORT void genn_setTimestep(unsigned long long timestep)" << OB(1180);
+    os << "iT = timestep;" << ENDL;
+    os << "t = iT * DT;" << ENDL;
+    os << CB(1180);
+    os << "GENN_EXPORT double genn_getTime(){ return t; }" << ENDL;
+    os << ENDL;
+
+    // host arrays, by the names they have in definitions.h
+    vector<string> arrays;
+    for(const auto &n : model.getNeuronGroups()) {
+        arrays.push_back("glbSpkCnt" + n.first);
+        arrays.push_back("glbSpk" + n.first);
+        if (n.second.isSpikeEventRequired()) {
+            arrays.push_back("glbSpkCntEvnt" + n.first);
+            arrays.push_back("glbSpkEvnt" + n.first);
+        }
+        if (n.second.isSpikeTimeRequired()) {
+            arrays.push_back("sT" + n.first);
+        }
+        for(const auto &v : n.second.getNonConstantVars()) {
+            arrays.push_back(v.first + n.first);
+        }
+    }
+    for(const auto &s : model.getSynapseGroups()) {
+        arrays.push_back("inSyn" + s.first);
+        if (s.second.isDendriticDelayRequired()) {
+            arrays.push_back("denDelay" + s.first);
+        }
+        if (s.second.getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+            arrays.push_back("gp" + s.first);
+        }
+        if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+            for(const auto &v : s.second.getNonConstantWUVars()) {
+                arrays.push_back(v.first + s.first);
+            }
+            for(const auto &v : s.second.getPSModel()->getVars()) {
+                arrays.push_back(v.first + s.first);
+            }
+        }
+    }
+
+    os << "GENN_EXPORT void *genn_getVar(const char *name)" << OB(1181);
+    for(const auto &a : arrays) {
+        os << "if (strcmp(name, \"" << a << "\") == 0) return " << a << ";" << ENDL;
+    }
+    for(const auto &s : model.getSynapseGroups()) {
+        if (s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+            os << "if (strcmp(name, \"C" << s.first << "\") == 0) return &C" << s.first << ";" << ENDL;
+        }
+    }
+    os << "return NULL;" << ENDL;
+    os << CB(1181);
+    os << ENDL;
+    os << "GENN_EXPORT const VarDescriptor *genn_getVarDescriptor(const char *name, const char *group){ return getVarDescriptor(name, group); }" << ENDL;
+    os << "GENN_EXPORT const VarDescriptor *genn_getVarDescriptorTable(){ return varDescriptorTable; }" << ENDL;
+    os << "GENN_EXPORT unsigned int genn_getNumVarDescriptors(){ return numVarDescriptors; }" << ENDL;
+
+    closeGeneratedFile(os, name);
+}
+
+
+//----------------------------------------------------------------------------
+/*!
+  \brief A function that writes the per-group choices made from the model's profile (see NNmodel::setProfile) to profileReport.txt.
+*/
+//----------------------------------------------------------------------------
+
+void genProfileReport(const NNmodel &model, //!< Model description
+                      const string &path    //!< Path for code generation
+                      )
+{
+    string name = path + "/" + model.getName() + "_CODE/profileReport.txt";
+    ofstream os;
+    openGeneratedFile(os, name);
+    os << "# Per-group choices made for model " << model.getName() << " from profile " << model.getProfile() << endl;
+    for(const auto &choice : model.getProfileReport()) {
+        os << choice << endl;
+    }
+    closeGeneratedFile(os, name);
+}
+
+
+//----------------------------------------------------------------------------
+/*!
+  \brief A function that generates the Makefile for all generated GeNN code.
+*/
+//----------------------------------------------------------------------------
+
+void genMakefile(const NNmodel &model, //!< Model description
+                 const string &path    //!< Path for code generation
+                 )
+{
+    string name = path + "/" + model.getName() + "_CODE/Makefile";
+    ofstream os;
+    openGeneratedFile(os, name);
+
+    // every generated source file is compiled as its own translation unit so that they can be built in
+    // parallel and only changed files are rebuilt - list them together with the files they include
+    vector<pair<string, string>> sources;
+#ifdef CPU_ONLY
+    sources.push_back(make_pair("runner", "runner.cc definitions.h"));
+    sources.push_back(make_pair("init", "init.cc definitions.h"));
+#else
+    string runnerDeps = "runner.cc definitions.h support_code.h init.cc runnerGPU.cc neuronKrnl.cc";
+    if (!model.getSynapseGroups().empty()) runnerDeps += " synapseKrnl.cc";
+    sources.push_back(make_pair("runner", runnerDeps));
+#endif
+    sources.push_back(make_pair("neuronFnct", "neuronFnct.cc definitions.h"));
+    set<string> mergedNeuronGroups;
+    for(size_t i = 0; i < model.getMergedNeuronGroups().size(); i++) {
+        const string name = "neuronFnctMerged" + to_string(i);
+        sources.push_back(make_pair(name, name + ".cc definitions.h support_code.h"));
+        mergedNeuronGroups.insert(model.getMergedNeuronGroups()[i].begin(), model.getMergedNeuronGroups()[i].end());
+    }
+    for(const auto &n : model.getNeuronGroups()) {
+        if (mergedNeuronGroups.find(n.first) == mergedNeuronGroups.end()) {
+            sources.push_back(make_pair("neuronFnct" + n.first, "neuronFnct" + n.first + ".cc definitions.h support_code.h"));
+        }
+    }
+    if (!model.getSynapseGroups().empty()) {
+        sources.push_back(make_pair("synapseFnct", "synapseFnct.cc definitions.h"));
+        for(const auto &s : model.getSynapseGroups()) {
+            sources.push_back(make_pair("synapseFnct" + s.first, "synapseFnct" + s.first + ".cc definitions.h support_code.h"));
+        }
+    }
+    if (GENN_PREFERENCES::buildSharedLibrary) {
+        sources.push_back(make_pair("sharedLibrary", "sharedLibrary.cc definitions.h"));
+    }
+
+#ifdef _WIN32
+
+#ifdef CPU_ONLY
+    string cxxFlags = "/c /DCPU_ONLY";
+    cxxFlags += " " + GENN_PREFERENCES::userCxxFlagsWIN;
+    if (GENN_PREFERENCES::optimizeCode) cxxFlags += " /O2";
+    if (GENN_PREFERENCES::debugCode) cxxFlags += " /debug /Zi /Od";
+    const string compile = "$(CXX) $(CXXFLAGS) $(INCLUDEFLAGS) /Fo";
+
+    os << endl;
+    os << "CXXFLAGS       =/nologo /EHsc " << cxxFlags << endl;
+    os << endl;
+    os << "INCLUDEFLAGS   =/I\"$(GENN_PATH)\\lib\\include\"" << endl;
+#else
+    string nvccFlags = "-c -x cu -arch sm_";
+    nvccFlags += to_string(deviceProp[theDevice].major) + to_string(deviceProp[theDevice].minor);
+    nvccFlags += " " + GENN_PREFERENCES::userNvccFlags;
+    if (GENN_PREFERENCES::optimizeCode) nvccFlags += " -O3 -use_fast_math";
+    if (GENN_PREFERENCES::debugCode) nvccFlags += " -O0 -g -G";
+    if (GENN_PREFERENCES::showPtxInfo) nvccFlags += " -Xptxas \"-v\"";
+    const string compile = "$(NVCC) $(NVCCFLAGS) $(INCLUDEFLAGS) -o ";
+
+    os << endl;
+    os << "NVCC           =\"" << NVCC << "\"" << endl;
+    os << "NVCCFLAGS      =" << nvccFlags << endl;
     os << endl;
-    os << "NVCC           :=\"" << NVCC << "\"" << endl;
-    os << "NVCCFLAGS      :=" << nvccFlags << endl;
-    os << endl;
-    os << "INCLUDEFLAGS   =-I\"$(GENN_PATH)/lib/include\"" << endl;
-    os << endl;
-    os << "all: runner.o" << endl;
-    os << endl;
-    os << "runner.o: runner.cc" << endl;
-    os << "\t$(NVCC) $(NVCCFLAGS) $(INCLUDEFLAGS) runner.cc" << endl;
+    os << "INCLUDEFLAGS   =-I\"$(GENN_PATH)\\lib\\include\"" << endl;
+#endif
+    os << endl;
+    os << "OBJECTS        =";
+    for(const auto &src : sources) {
+        os << " " << src.first << ".obj";
+    }
+    os << endl;
+    os << endl;
+    os << "all: runner.lib" << endl;
+    os << endl;
+    os << "runner.lib: $(OBJECTS)" << endl;
+    os << "\tlib /NOLOGO /OUT:runner.lib $(OBJECTS)" << endl;
+    for(const auto &src : sources) {
+        os << endl;
+        os << src.first << ".obj: " << src.second << endl;
+        os << "\t" << compile << src.first << ".obj " << src.first << ".cc" << endl;
+    }
     os << endl;
     os << "clean:" << endl;
-    os << "\trm -f runner.o" << endl;
+    os << "\t-del runner.lib $(OBJECTS) 2>nul" << endl;
+
+#else // UNIX
+
+    const string sharedLibrary = "lib" + model.getName() + ".so";
+#ifdef CPU_ONLY
+    string cxxFlags = "-c -DCPU_ONLY";
+    cxxFlags += " " + GENN_PREFERENCES::userCxxFlagsGNU;
+    if (GENN_PREFERENCES::optimizeCode) cxxFlags += " -O3 -ffast-math";
+    if (GENN_PREFERENCES::debugCode) cxxFlags += " -O0 -g";
+    if (GENN_PREFERENCES::buildSharedLibrary) cxxFlags += " -fPIC -fvisibility=hidden";
+    const string compiler = "$(CXX)";
+    const string link = "$(CXX) -shared -o $@ ";
+    const string compile = "$(CXX) $(CXXFLAGS) $(INCLUDEFLAGS) -o $@ ";
+    hashGeneratedCode(cxxFlags);
+
+    os << endl;
+    os << "MODEL_HASH     :=" << getGeneratedCodeHash() << endl;
+    os << "CXXFLAGS       :=" << cxxFlags << endl;
+#else
+    string nvccFlags = "-c -x cu -arch sm_";
+    nvccFlags += to_string(deviceProp[theDevice].major) + to_string(deviceProp[theDevice].minor);
+    nvccFlags += " " + GENN_PREFERENCES::userNvccFlags;
+    if (GENN_PREFERENCES::optimizeCode) nvccFlags += " -O3 -use_fast_math -Xcompiler \"-ffast-math\"";
+    if (GENN_PREFERENCES::debugCode) nvccFlags += " -O0 -g -G";
+    if (GENN_PREFERENCES::showPtxInfo) nvccFlags += " -Xptxas \"-v\"";
+    if (GENN_PREFERENCES::buildSharedLibrary) nvccFlags += " -Xcompiler \"-fPIC -fvisibility=hidden\"";
+    const string compiler = "$(NVCC)";
+    const string link = "$(NVCC) -shared -o $@ ";
+    const string compile = "$(NVCC) $(NVCCFLAGS) $(INCLUDEFLAGS) -o $@ ";
+    hashGeneratedCode(string(NVCC) + nvccFlags);
+
+    os << endl;
+    os << "MODEL_HASH     :=" << getGeneratedCodeHash() << endl;
+    os << "NVCC           :=\"" << NVCC << "\"" << endl;
+    os << "NVCCFLAGS      :=" << nvccFlags << endl;
 #endif
+    os << endl;
+    os << "INCLUDEFLAGS   =-I\"$(GENN_PATH)/lib/include\"" << endl;
+    os << endl;
+    os << "OBJECTS        :=";
+    for(const auto &src : sources) {
+        os << " obj/" << src.first << ".o";
+    }
+    os << endl;
+    os << endl;
+    os << "# If GENN_CACHE_PATH is set, compiled objects are cached there keyed on the hash of the generated code and the compiler" << endl;
+    os << "ifdef GENN_CACHE_PATH" << endl;
+    os << "    CACHE_DIR  :=$(GENN_CACHE_PATH)/$(MODEL_HASH)-$(notdir $(subst \",," << compiler << "))" << endl;
+    os << "endif" << endl;
+    os << endl;
+    os << ".PHONY: all clean" << endl;
+    os << endl;
+    os << "all: runner.o";
+    if (GENN_PREFERENCES::buildSharedLibrary) {
+        os << " " << sharedLibrary;
+    }
+    os << endl;
+    os << endl;
+    os << "# The objects of all translation units are combined into runner.o by partial linking" << endl;
+    os << "ifdef GENN_CACHE_PATH" << endl;
+    os << "runner.o:";
+    for(const auto &src : sources) {
+        os << " " << src.first << ".cc";
+    }
+    os << " definitions.h support_code.h" << endl;
+    os << "\t@if [ -f \"$(CACHE_DIR)/runner.o\" ]; then \\" << endl;
+    os << "\t    echo \"Using cached runner.o for model hash $(MODEL_HASH)\"; \\" << endl;
+    os << "\t    cp \"$(CACHE_DIR)/runner.o\" runner.o; \\" << endl;
+    os << "\telse \\" << endl;
+    os << "\t    $(MAKE) --no-print-directory $(OBJECTS) && \\" << endl;
+    os << "\t    $(LD) -r -o runner.o $(OBJECTS) && \\" << endl;
+    os << "\t    mkdir -p \"$(CACHE_DIR)\" && \\" << endl;
+    os << "\t    cp runner.o \"$(CACHE_DIR)/runner.o\"; \\" << endl;
+    os << "\tfi" << endl;
+    os << "else" << endl;
+    os << "runner.o: $(OBJECTS)" << endl;
+    os << "\t$(LD) -r -o runner.o $(OBJECTS)" << endl;
+    os << "endif" << endl;
+    os << endl;
+    if (GENN_PREFERENCES::buildSharedLibrary) {
+        os << "# Position-independent objects with hidden visibility are linked into a shared library which only exports sharedLibrary.cc's C interface" << endl;
+        os << sharedLibrary << ": $(OBJECTS)" << endl;
+        os << "\t" << link << "$(OBJECTS)" << endl;
+        os << endl;
+    }
+    os << "$(OBJECTS): | obj" << endl;
+    os << endl;
+    os << "obj:" << endl;
+    os << "\tmkdir -p obj" << endl;
+    for(const auto &src : sources) {
+        os << endl;
+        os << "obj/" << src.first << ".o: " << src.second << endl;
+        os << "\t" << compile << src.first << ".cc" << endl;
+    }
+    os << endl;
+    os << "clean:" << endl;
+    os << "\trm -rf obj runner.o";
+    if (GENN_PREFERENCES::buildSharedLibrary) {
+        os << " " << sharedLibrary;
+    }
+    os << endl;
 
 #endif
 
-    os.close();
+    closeGeneratedFile(os, name);
 }
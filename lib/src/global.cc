@@ -44,6 +44,11 @@ namespace GENN_PREFERENCES {
     unsigned int learningBlockSize= 32;
     unsigned int synapseDynamicsBlockSize= 32;
     unsigned int autoRefractory= 1; //!< Flag for signalling whether spikes are only reported if thresholdCondition changes from false to true (autoRefractory == 1) or spikes are emitted whenever thresholdCondition is true no matter what.
+    bool promoteConstantVars= false; //!< Request that state variables which no code snippet writes to are substituted as constants with their initial values rather than stored in arrays
+    bool mergeIdenticalGroups= true; //!< Request that the CPU updates of neuron groups which only differ in parameter values and size share one generated loop
+    bool buildSharedLibrary= false; //!< Request that the generated code is additionally linked into a position-independent shared library (lib<model>.so) exporting the C interface used by SharedLibraryModel (UNIX only)
+    double profileHotGroupShare= 0.25; //!< Share of the profiled neuron update time from which a neuron group keeps its own specialised CPU update rather than being merged (see NNmodel::setProfile)
+    unsigned int codeGenerationThreads= 0; //!< Number of threads used to generate code - 0 uses one per hardware thread
     std::string userCxxFlagsWIN = ""; //!< Allows users to set specific C++ compiler options they may want to use for all host side code (used for windows platforms)
     std::string userCxxFlagsGNU = ""; //!< Allows users to set specific C++ compiler options they may want to use for all host side code (used for unix based platforms)
     std::string userNvccFlags = ""; //!< Allows users to set specific nvcc compiler options they may want to use for all GPU code (identical for windows and unix platforms)
@@ -28,6 +28,89 @@
 #include <cmath>
 #include <cassert>
 #include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+
+// ------------------------------------------------------------------------
+// Anonymous namespace
+// ------------------------------------------------------------------------
+namespace
+{
+//! Report the state variables of a group which no code snippet writes to and whether they have been promoted to constants
+void reportReadOnlyVars(const string &groupDescription, const set<string> &vars)
+{
+    if (vars.empty()) {
+        return;
+    }
+
+    string varList;
+    for(const auto &v : vars) {
+        varList += (varList.empty() ? "" : ", ") + v;
+    }
+    if (GENN_PREFERENCES::promoteConstantVars) {
+        cout << "Promoted variables " << varList << " of " << groupDescription << " to constants" << endl;
+    }
+    else {
+        cout << "Variables " << varList << " of " << groupDescription << " are never written by the model code";
+        cout << " - set GENN_PREFERENCES::promoteConstantVars to substitute them as constants" << endl;
+    }
+}
+
+//! Cost and events of one phase of one group's update, as written by dumpProfile() in a profiling build
+struct GroupProfile
+{
+    unsigned long long updates;
+    double seconds;
+    unsigned long long events;
+
+    double getMeanSeconds() const{ return (updates == 0) ? 0.0 : (seconds / (double)updates); }
+    double getMeanEvents() const{ return (updates == 0) ? 0.0 : ((double)events / (double)updates); }
+};
+
+typedef map<pair<string, string>, GroupProfile> Profile;
+
+//! Read a profile written by dumpProfile(), keyed by phase and group name
+Profile readProfile(const string &filename)
+{
+    ifstream is(filename.c_str());
+    if (!is.good()) {
+        gennError("Cannot open profile " + filename);
+    }
+
+    Profile profile;
+    string line;
+    while (getline(is, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        istringstream lineStream(line);
+        string phase, group;
+        GroupProfile p;
+        if (!(lineStream >> phase >> group >> p.updates >> p.seconds >> p.events)) {
+            gennError("Cannot parse line '" + line + "' of profile " + filename);
+        }
+        profile[make_pair(phase, group)] = p;
+    }
+    return profile;
+}
+
+//! Find the profile of one phase of one group or return NULL if it was not profiled
+const GroupProfile *findGroupProfile(const Profile &profile, const string &phase, const string &group)
+{
+    const auto p = profile.find(make_pair(phase, group));
+    return (p == profile.end()) ? NULL : &p->second;
+}
+
+string formatNumber(double value)
+{
+    ostringstream stream;
+    stream << value;
+    return stream.str();
+}
+}   // Anonymous namespace
 
 unsigned int GeNNReady = 0;
 
@@ -55,6 +138,10 @@ NNmodel::NNmodel()
     setDT(0.5);
     setPrecision(GENN_FLOAT);
     setTiming(false);
+    setGroupTiming(false);
+    setEventCounting(false);
+    setRealTimePacing(false);
+    setBatchSize(1);
     RNtype= "uint64_t";
 #ifndef CPU_ONLY
     setGPUDevice(AUTODEVICE);
@@ -93,6 +180,18 @@ bool NNmodel::zeroCopyInUse() const
     return false;
 }
 
+bool NNmodel::inputQueueInUse() const
+{
+    return any_of(begin(m_NeuronGroups), end(m_NeuronGroups),
+                  [](const std::pair<string, NeuronGroup> &n){ return n.second.isInputQueueEnabled(); });
+}
+
+bool NNmodel::spikeRecordingInUse() const
+{
+    return any_of(begin(m_NeuronGroups), end(m_NeuronGroups),
+                  [](const std::pair<string, NeuronGroup> &n){ return n.second.isSpikeRecordingEnabled(); });
+}
+
 //--------------------------------------------------------------------------
 /*! \brief This function is for setting which host and which device a neuron group will be simulated on
  */
@@ -629,6 +728,86 @@ void NNmodel::setTiming(bool theTiming /**<  */)
 }
 
 
+//--------------------------------------------------------------------------
+/*! \brief This function sets a flag to determine whether the update of each neuron and synapse group is timed individually in the generated CPU code.
+ */
+//--------------------------------------------------------------------------
+
+void NNmodel::setGroupTiming(bool theGroupTiming /**<  */)
+{
+    if (final) {
+        gennError("Trying to set group timing flag in a finalized model.");
+    }
+    groupTiming= theGroupTiming;
+}
+
+
+//--------------------------------------------------------------------------
+/*! \brief This function sets a flag to determine whether the generated CPU code counts the spikes emitted by each neuron group and the presynaptic events, synapse updates, post-learning updates and synapse dynamics updates of each synapse group.
+ */
+//--------------------------------------------------------------------------
+
+void NNmodel::setEventCounting(bool theEventCounting /**<  */)
+{
+    if (final) {
+        gennError("Trying to set event counting flag in a finalized model.");
+    }
+    eventCounting= theEventCounting;
+}
+
+
+//--------------------------------------------------------------------------
+/*! \brief This function sets a flag to determine whether the generated runner contains stepTimeRealTimeCPU(), which paces the CPU time steps so that simulated time advances at a set ratio to wall-clock time and records their latency, jitter and deadline misses.
+ */
+//--------------------------------------------------------------------------
+
+void NNmodel::setRealTimePacing(bool theRealTimePacing /**<  */)
+{
+    if (final) {
+        gennError("Trying to set real-time pacing flag in a finalized model.");
+    }
+    realTimePacing= theRealTimePacing;
+}
+
+
+//--------------------------------------------------------------------------
+/*! \brief This function sets the profile from which finalize() chooses per-group update strategies.
+
+  The profile is written by dumpProfile() in a build of the same model with setGroupTiming(true) and setEventCounting(true).
+ */
+//--------------------------------------------------------------------------
+
+void NNmodel::setProfile(const string &filename /**< Name of profile file */)
+{
+    if (final) {
+        gennError("Trying to set profile in a finalized model.");
+    }
+    profile= filename;
+}
+
+
+//--------------------------------------------------------------------------
+/*! \brief This function sets the number of independent instances of the model which are simulated together.
+
+  All instances share the connectivity and parameters of the model but have their own neuron, postsynaptic and
+  individual synapse variables, input and spikes. Each state array holds the instances of an element next to each
+  other i.e. variable V of neuron n in instance b is VPop[(n * BATCH_SIZE) + b], while the spikes of instance b are
+  glbSpkPop[(b * N) + i] for i < glbSpkCntPop[b]. One call to stepTimeCPU() advances all instances.
+ */
+//--------------------------------------------------------------------------
+
+void NNmodel::setBatchSize(unsigned int theBatchSize /**< Number of instances */)
+{
+    if (final) {
+        gennError("Trying to set the batch size of a finalized model.");
+    }
+    if (theBatchSize == 0) {
+        gennError("The batch size must be at least 1.");
+    }
+    batchSize= theBatchSize;
+}
+
+
 //--------------------------------------------------------------------------
 /*! \brief This function sets the random seed. If the passed argument is > 0, automatic seeding is disabled. If the argument is 0, the underlying seed is obtained from the time() function.
  */
@@ -757,9 +936,13 @@ void NNmodel::finalize()
 
                 // do an early replacement of parameters, derived parameters and extraglobalsynapse parameters
                 string eCode = wu->getEventThresholdConditionCode();
-                value_substitutions(eCode, wu->getParamNames(), sg->getWUParams());
-                value_substitutions(eCode, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams());
-                name_substitutions(eCode, "", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg->getName());
+                CodeSubstitutions substitutions;
+                substitutions.addParamSubstitutions(wu->getParamNames(), sg->getWUParams(),
+                                                    sg->getWURuntimeParams(), sg->getWURuntimeParamsName());
+                substitutions.addParamSubstitutions(wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams(),
+                                                    sg->getWURuntimeParams(), sg->getWURuntimeParamsName());
+                substitutions.addNameSubstitutions("", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg->getName());
+                substitutions.apply(eCode);
 
                 // Add code and name of
                 string supportCodeNamespaceName = wu->getSimSupportCode().empty() ?
@@ -788,6 +971,14 @@ void NNmodel::finalize()
 
         // Make extra global parameter lists
         n.second.addExtraGlobalParams(neuronKernelParameters);
+
+        // Runtime parameters are passed to every kernel which may substitute them
+        if (n.second.isRuntimeParamsRequired()) {
+            const string runtimeParamsType = "RuntimeParams" + n.first;
+            neuronKernelParameters.emplace(n.second.getRuntimeParamsName(), runtimeParamsType);
+            synapseKernelParameters.emplace(n.second.getRuntimeParamsName(), runtimeParamsType);
+            synapseDynamicsKernelParameters.emplace(n.second.getRuntimeParamsName(), runtimeParamsType);
+        }
     }
 
     // SYNAPSE groups
@@ -817,10 +1008,152 @@ void NNmodel::finalize()
         s.second.addExtraGlobalSynapseParams(synapseKernelParameters);
         s.second.addExtraGlobalNeuronParams(neuronKernelParameters);
 
+        // Runtime weight update parameters are passed to every kernel which may substitute them
+        if (s.second.isWURuntimeParamsRequired()) {
+            const string runtimeParamsType = "WURuntimeParams" + s.first;
+            synapseKernelParameters.emplace(s.second.getWURuntimeParamsName(), runtimeParamsType);
+            synapseDynamicsKernelParameters.emplace(s.second.getWURuntimeParamsName(), runtimeParamsType);
+            if (!wu->getEventCode().empty()) {
+                neuronKernelParameters.emplace(s.second.getWURuntimeParamsName(), runtimeParamsType);
+            }
+        }
+    }
+
+    // Choose per-group strategies from the costs and event rates measured by a profiling build
+    Profile profileData;
+    map<string, double> neuronTimeShares;
+    if (!profile.empty()) {
+        profileData = readProfile(profile);
+
+        // The GPU synapse kernel processes a sparse projection with one thread per presynaptic spike (presynaptic span)
+        // when there are more spikes per step than row entries, otherwise with one thread per row entry (postsynaptic span)
+        for(auto &s : m_SynapseGroups) {
+            if (!(s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE)) {
+                continue;
+            }
+
+            const string group = "synapse group " + s.first + ": ";
+            const GroupProfile *p = findGroupProfile(profileData, "synapse", s.first);
+            if (s.second.getSpanType() == SynapseGroup::SpanType::PRESYNAPTIC) {
+                m_ProfileReport.push_back(group + "presynaptic span set with setSpanTypeToPre");
+            }
+            else if (p == NULL) {
+                m_ProfileReport.push_back(group + "not profiled - postsynaptic span");
+            }
+            else {
+                const double spikesPerStep = p->getMeanEvents();
+                const bool presynaptic = (spikesPerStep > (double)s.second.getMaxConnections());
+                if (presynaptic) {
+                    s.second.setSpanType(SynapseGroup::SpanType::PRESYNAPTIC);
+                }
+                m_ProfileReport.push_back(group + formatNumber(spikesPerStep) + " presynaptic spikes per step, up to "
+                                          + to_string(s.second.getMaxConnections()) + " connections per presynaptic neuron - "
+                                          + (presynaptic ? "presynaptic span" : "postsynaptic span"));
+            }
+        }
+
+        // Share of the total neuron update time spent updating each profiled neuron group
+        double totalNeuronSeconds = 0.0;
+        for(const auto &n : m_NeuronGroups) {
+            const GroupProfile *p = findGroupProfile(profileData, "neuron", n.first);
+            if (p != NULL) {
+                neuronTimeShares[n.first] = p->getMeanSeconds();
+                totalNeuronSeconds += p->getMeanSeconds();
+            }
+        }
+        for(auto &n : neuronTimeShares) {
+            n.second = (totalNeuronSeconds > 0.0) ? (n.second / totalNeuronSeconds) : 0.0;
+        }
     }
 
     setPopulationSums();
 
+    // Batched simulation is only generated for the CPU and for the features whose state is per neuron or per synapse
+    if (batchSize > 1) {
+#ifndef CPU_ONLY
+        gennError("Batched simulation (setBatchSize) is only supported in CPU_ONLY builds.");
+#endif
+        for(const auto &n : m_NeuronGroups) {
+            if (n.second.isDelayRequired()) {
+                gennError("Neuron group " + n.first + " requires spike or variable queues which are not supported in batched simulation.");
+            }
+            if (n.second.isInputQueueEnabled()) {
+                gennError("Neuron group " + n.first + " has an input queue which is not supported in batched simulation.");
+            }
+        }
+        if (!m_SynapsePostLearnGroups.empty() || !m_SynapseDynamicsGroups.empty()) {
+            gennError("Postsynaptic learning and synapse dynamics are not supported in batched simulation.");
+        }
+    }
+
+    // Groups which are not updated on every time step do not write the current slot of their variable queues in between
+    for(const auto &n : m_NeuronGroups) {
+        if (n.second.getUpdatePeriod() > 1 && n.second.isVarQueueRequired() && n.second.isDelayRequired()) {
+            gennError("Neuron group " + n.first + " has an update period but its variables are read with a delay, which is not supported.");
+        }
+        if (n.second.isQuiescenceSkippingEnabled() && n.second.isVarQueueRequired() && n.second.isDelayRequired()) {
+            gennError("Neuron group " + n.first + " skips updates at rest but its variables are read with a delay, which is not supported.");
+        }
+    }
+
+    // Lazily decayed input is stored scaled by the decay of its group so it must only be added to by spikes
+    for(const auto &s : m_SynapseGroups) {
+        if (s.second.isPSLazyDecayEnabled()) {
+            const string &sdCode = s.second.getWUModel()->getSynapseDynamicsCode();
+            if (sdCode.find("inSyn") != string::npos || sdCode.find("updatelinsyn") != string::npos) {
+                gennError("Synapse group " + s.first + " decays its input lazily but its synapse dynamics add to it, which is not supported.");
+            }
+        }
+    }
+
+    // Delayed input is moved from the ring buffer into the input of the postsynaptic neurons on every time step
+    for(const auto &s : m_SynapseGroups) {
+        if (s.second.isDendriticDelayRequired()) {
+#ifndef CPU_ONLY
+            gennError("Dendritic delays (setDendriticDelay) are only supported in CPU_ONLY builds.");
+#endif
+            const NeuronGroup *trg = s.second.getTrgNeuronGroup();
+            if (batchSize > 1) {
+                gennError("Synapse group " + s.first + " has dendritic delays which are not supported in batched simulation.");
+            }
+            if (trg->getUpdatePeriod() > 1 || trg->isQuiescenceSkippingEnabled()) {
+                gennError("Synapse group " + s.first + " has dendritic delays but its postsynaptic neuron group is not updated on every time step, which is not supported.");
+            }
+            if (s.second.isPSLazyDecayEnabled()) {
+                gennError("Synapse group " + s.first + " has dendritic delays and decays its input lazily, which is not supported.");
+            }
+        }
+    }
+
+    // Find the state variables which no code snippet writes to and, if requested, substitute them as constants
+    for(auto &n : m_NeuronGroups) {
+        set<string> readOnlyVars;
+        for(const auto &v : n.second.getNeuronModel()->getVars()) {
+            if (!n.second.isVarWritten(v.first)) {
+                readOnlyVars.insert(v.first);
+            }
+        }
+        reportReadOnlyVars("neuron group " + n.first, readOnlyVars);
+        if (GENN_PREFERENCES::promoteConstantVars) {
+            n.second.setConstantVars(readOnlyVars);
+        }
+    }
+    for(auto &s : m_SynapseGroups) {
+        // **NOTE** variables of GLOBALG synapse groups are always constants
+        if (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+            set<string> readOnlyVars;
+            for(const auto &v : s.second.getWUModel()->getVars()) {
+                if (!s.second.isWUVarZeroCopyEnabled(v.first) && !s.second.isWUCodeWriting(v.first)) {
+                    readOnlyVars.insert(v.first);
+                }
+            }
+            reportReadOnlyVars("synapse group " + s.first, readOnlyVars);
+            if (GENN_PREFERENCES::promoteConstantVars) {
+                s.second.setConstantWUVars(readOnlyVars);
+            }
+        }
+    }
+
 #ifndef CPU_ONLY
     // figure out where to reset the spike counters
     if (m_SynapseGroups.empty()) { // no synapses -> reset in neuron kernel
@@ -834,6 +1167,71 @@ void NNmodel::finalize()
             resetKernel= GENN_FLAGS::calcSynapses;
         }
     }
+#else
+    // merge neuron groups whose CPU updates only differ in parameter values and size - unless the profile shows that
+    // a group takes a large share of the update time, in which case it keeps its own update with constant parameters
+    const auto isHotNeuronGroup = [&neuronTimeShares](const string &name)
+    {
+        const auto share = neuronTimeShares.find(name);
+        return (share != neuronTimeShares.end() && share->second >= GENN_PREFERENCES::profileHotGroupShare);
+    };
+    if (GENN_PREFERENCES::mergeIdenticalGroups) {
+        vector<vector<NeuronGroup*>> mergeSets;
+        for(auto &n : m_NeuronGroups) {
+            if (isHotNeuronGroup(n.first)) {
+                continue;
+            }
+            auto mergeSet = find_if(mergeSets.begin(), mergeSets.end(),
+                                    [&n](const vector<NeuronGroup*> &m){ return m.front()->canMerge(n.second); });
+            if (mergeSet == mergeSets.end()) {
+                mergeSets.push_back({&n.second});
+            }
+            else {
+                mergeSet->push_back(&n.second);
+            }
+        }
+
+        for(const auto &m : mergeSets) {
+            if (m.size() < 2) {
+                continue;
+            }
+
+            // parameters whose values differ within the set are read from the merged group table
+            const NeuronGroup *archetype = m.front();
+            vector<bool> heterogeneousParams(archetype->getParams().size(), false);
+            vector<bool> heterogeneousDerivedParams(archetype->getDerivedParams().size(), false);
+            for(const auto *ng : m) {
+                for(size_t i = 0; i < heterogeneousParams.size(); i++) {
+                    heterogeneousParams[i] = heterogeneousParams[i] || (ng->getParams()[i] != archetype->getParams()[i]);
+                }
+                for(size_t i = 0; i < heterogeneousDerivedParams.size(); i++) {
+                    heterogeneousDerivedParams[i] = heterogeneousDerivedParams[i] || (ng->getDerivedParams()[i] != archetype->getDerivedParams()[i]);
+                }
+            }
+
+            m_MergedNeuronGroups.emplace_back();
+            for(auto *ng : m) {
+                ng->setHeterogeneousParams(heterogeneousParams, heterogeneousDerivedParams);
+                m_MergedNeuronGroups.back().push_back(ng->getName());
+            }
+        }
+    }
+
+    if (!profile.empty()) {
+        for(const auto &n : m_NeuronGroups) {
+            const string group = "neuron group " + n.first + ": ";
+            const auto share = neuronTimeShares.find(n.first);
+            if (share == neuronTimeShares.end()) {
+                m_ProfileReport.push_back(group + "not profiled");
+                continue;
+            }
+
+            const bool merged = any_of(m_MergedNeuronGroups.begin(), m_MergedNeuronGroups.end(),
+                                       [&n](const vector<string> &m){ return find(m.begin(), m.end(), n.first) != m.end(); });
+            m_ProfileReport.push_back(group + formatNumber(100.0 * share->second) + "% of the neuron update time - "
+                                      + (merged ? "merged CPU update" : (isHotNeuronGroup(n.first) ? "specialised CPU update" : "own CPU update")));
+        }
+    }
 #endif
 }
 
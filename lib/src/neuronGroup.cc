@@ -7,6 +7,7 @@
 // GeNN includes
 #include "codeGenUtils.h"
 #include "standardSubstitutions.h"
+#include "synapseGroup.h"
 #include "utils.h"
 
 // ------------------------------------------------------------------------
@@ -52,6 +53,42 @@ void NeuronGroup::setVarZeroCopyEnabled(const std::string &var, bool enabled)
 }
 
 
+void NeuronGroup::setUpdatePeriod(unsigned int numSteps)
+{
+    if (numSteps == 0) {
+        gennError("The update period of neuron group " + getName() + " must be at least one time step");
+    }
+    m_UpdatePeriod = numSteps;
+}
+
+void NeuronGroup::setQuiescenceSkippingEnabled(bool enabled)
+{
+    if (enabled && getNeuronModel()->getRestConditionCode().empty()) {
+        gennError("Quiescence skipping cannot be enabled for neuron group " + getName() + " as its neuron model has no rest condition");
+    }
+    m_QuiescenceSkippingEnabled = enabled;
+}
+
+void NeuronGroup::setParamRuntimeEnabled(const std::string &param, bool enabled)
+{
+    // If named parameter doesn't exist give error
+    const auto paramNames = getNeuronModel()->getParamNames();
+    if(find(paramNames.begin(), paramNames.end(), param) == paramNames.end()) {
+        gennError("Cannot find parameter " + param);
+    }
+    // Otherwise add name of parameter to set
+    else {
+        // If enabled, add parameter to set
+        if(enabled) {
+            m_RuntimeParams.insert(param);
+        }
+        // Otherwise, remove it
+        else {
+            m_RuntimeParams.erase(param);
+        }
+    }
+}
+
 void NeuronGroup::addSpkEventCondition(const std::string &code, const std::string &supportCodeNamespace)
 {
     m_SpikeEventCondition.insert(std::pair<std::string, std::string>(code, supportCodeNamespace));
@@ -61,6 +98,9 @@ void NeuronGroup::initDerivedParams(double dt)
 {
     auto derivedParams = getNeuronModel()->getDerivedParams();
 
+    // Derived parameters are calculated for the time the group advances by in each update
+    dt *= getUpdatePeriod();
+
     // Reserve vector to hold derived parameters
     m_DerivedParams.reserve(derivedParams.size());
 
@@ -68,6 +108,10 @@ void NeuronGroup::initDerivedParams(double dt)
     for(const auto &d : derivedParams) {
         m_DerivedParams.push_back(d.second(m_Params, dt));
     }
+
+    // Keep derived parameters which depend on runtime parameters as runtime values too
+    addRuntimeDerivedParams(getName(), getNeuronModel()->getParamNames(), m_Params, derivedParams, m_DerivedParams,
+                            dt, m_RuntimeParams);
 }
 
 void NeuronGroup::calcSizes(unsigned int blockSize,  unsigned int &idStart, unsigned int &paddedIDStart)
@@ -115,6 +159,61 @@ bool NeuronGroup::isVarZeroCopyEnabled(const std::string &var) const
     return (m_VarZeroCopyEnabled.find(var) != std::end(m_VarZeroCopyEnabled));
 }
 
+bool NeuronGroup::isParamRuntimeEnabled(const std::string &param) const
+{
+    return (m_RuntimeParams.find(param) != std::end(m_RuntimeParams));
+}
+
+bool NeuronGroup::isVarWritten(const std::string &var) const
+{
+    // Input queues and zero-copied memory give the host write access while the model is simulated
+    if(isInputQueueEnabled() || isVarZeroCopyEnabled(var)) {
+        return true;
+    }
+
+    // Check the neuron model's own code
+    const auto *nm = getNeuronModel();
+    if(isVarAssigned(nm->getSimCode(), var) || isVarAssigned(nm->getThresholdConditionCode(), var)
+        || isVarAssigned(nm->getResetCode(), var))
+    {
+        return true;
+    }
+
+    // Check the postsynaptic and weight update models of incoming synapse groups
+    for(const auto *sg : getInSyn()) {
+        const auto *psm = sg->getPSModel();
+        if(isVarAssigned(psm->getCurrentConverterCode(), var) || isVarAssigned(psm->getDecayCode(), var)
+            || sg->isWUCodeWriting(var + "_post"))
+        {
+            return true;
+        }
+    }
+
+    // Check the weight update models of outgoing synapse groups
+    for(const auto *sg : getOutSyn()) {
+        if(sg->isWUCodeWriting(var + "_pre")) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool NeuronGroup::isVarConstant(const std::string &var) const
+{
+    return (m_ConstantVars.find(var) != std::end(m_ConstantVars));
+}
+
+NewModels::Base::StringPairVec NeuronGroup::getNonConstantVars() const
+{
+    NewModels::Base::StringPairVec vars;
+    for(const auto &v : getNeuronModel()->getVars()) {
+        if(!isVarConstant(v.first)) {
+            vars.push_back(v);
+        }
+    }
+    return vars;
+}
+
 bool NeuronGroup::isParamRequiredBySpikeEventCondition(const std::string &pnamefull) const
 {
     // Loop through event conditions
@@ -129,6 +228,103 @@ bool NeuronGroup::isParamRequiredBySpikeEventCondition(const std::string &pnamef
     return false;
 }
 
+bool NeuronGroup::canMerge(const NeuronGroup &other) const
+{
+    // Neuron models must generate the same code apart from parameter values
+    const auto *nm = getNeuronModel();
+    const auto *otherNM = other.getNeuronModel();
+    if (nm->getSimCode() != otherNM->getSimCode()
+        || nm->getThresholdConditionCode() != otherNM->getThresholdConditionCode()
+        || nm->getResetCode() != otherNM->getResetCode()
+        || nm->getRestConditionCode() != otherNM->getRestConditionCode()
+        || nm->getSupportCode() != otherNM->getSupportCode()
+        || nm->getParamNames() != otherNM->getParamNames()
+        || nm->getVars() != otherNM->getVars()
+        || nm->getExtraGlobalParams() != otherNM->getExtraGlobalParams()
+        || nm->isPoisson() != otherNM->isPoisson()
+        || getParams().size() != other.getParams().size())
+    {
+        return false;
+    }
+
+    // Runtime parameters are read from a structure specific to each group
+    if (isRuntimeParamsRequired() || other.isRuntimeParamsRequired()) {
+        return false;
+    }
+
+    // Groups must be updated on the same time steps and DT is substituted into their code
+    if (getUpdatePeriod() != other.getUpdatePeriod()) {
+        return false;
+    }
+
+    // Groups must either both or neither be skipped while at rest
+    if (isQuiescenceSkippingEnabled() != other.isQuiescenceSkippingEnabled()) {
+        return false;
+    }
+
+    // Variables promoted to constants must be the same, with the same values
+    if (getConstantVars() != other.getConstantVars()) {
+        return false;
+    }
+    for(size_t i = 0; i < nm->getVars().size(); i++) {
+        if (isVarConstant(nm->getVars()[i].first) && getInitVals()[i] != other.getInitVals()[i]) {
+            return false;
+        }
+    }
+
+    DerivedParamNameIterCtx nmDerivedParams(nm->getDerivedParams());
+    DerivedParamNameIterCtx otherNMDerivedParams(otherNM->getDerivedParams());
+    if (nmDerivedParams.container.size() != otherNMDerivedParams.container.size()
+        || !std::equal(nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, otherNMDerivedParams.nameBegin))
+    {
+        return false;
+    }
+
+    // Spikes, spike-like events, spike times and spike queues must be handled identically
+    if (isSpikeTimeRequired() != other.isSpikeTimeRequired()
+        || isTrueSpikeRequired() != other.isTrueSpikeRequired()
+        || isSpikeEventRequired() != other.isSpikeEventRequired()
+        || getNumDelaySlots() != other.getNumDelaySlots()
+        || m_VarQueueRequired != other.m_VarQueueRequired
+        || getSpikeEventCondition() != other.getSpikeEventCondition())
+    {
+        return false;
+    }
+
+    // The group size only ends up in the generated update through the spike queue offsets
+    if (isDelayRequired() && getNumNeurons() != other.getNumNeurons()) {
+        return false;
+    }
+
+    // Incoming synapse groups must apply the same postsynaptic models with the same parameters
+    if (getInSyn().size() != other.getInSyn().size()) {
+        return false;
+    }
+    for(size_t i = 0; i < getInSyn().size(); i++) {
+        const SynapseGroup *sg = getInSyn()[i];
+        const SynapseGroup *otherSG = other.getInSyn()[i];
+        const auto *psm = sg->getPSModel();
+        const auto *otherPSM = otherSG->getPSModel();
+        const bool individual = (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL);
+        if (psm->getDecayCode() != otherPSM->getDecayCode()
+            || psm->getCurrentConverterCode() != otherPSM->getCurrentConverterCode()
+            || psm->getSupportCode() != otherPSM->getSupportCode()
+            || psm->getParamNames() != otherPSM->getParamNames()
+            || psm->getVars() != otherPSM->getVars()
+            || individual != (bool)(otherSG->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)
+            || sg->getPSParams() != otherSG->getPSParams()
+            || sg->getPSDerivedParams() != otherSG->getPSDerivedParams()
+            || sg->isPSLazyDecayEnabled() != otherSG->isPSLazyDecayEnabled()
+            || sg->getMaxDendriticDelaySteps() != otherSG->getMaxDendriticDelaySteps()
+            || (!individual && sg->getPSInitVals() != otherSG->getPSInitVals()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void NeuronGroup::addExtraGlobalParams(std::map<string, string> &kernelParameters) const
 {
     for(auto const &p : getNeuronModel()->getExtraGlobalParams()) {
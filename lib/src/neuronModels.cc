@@ -386,9 +386,11 @@ void prepareStandardModels()
     n.dpNames.clear(); 
     n.simCode= "";
     n.thresholdConditionCode = "0";
+    n.restConditionCode = "1";
     n.dps= NULL;
     nModels.push_back(n);
     SPIKESOURCE= nModels.size()-1;
+    n.restConditionCode = "";
 
 
 #include "extra_neurons.h"
@@ -1,5 +1,82 @@
 #include "newNeuronModels.h"
 
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+const char *traubMilesStateVars[] = {"V", "m", "h", "n"};
+
+//! Generate code evaluating the Traub & Miles derivatives of V, m, h and n at the state held
+//! in the variables prefixed by state (or the neuron's own variables if state is empty)
+//! into variables prefixed by derivative e.g. _k1V, _k1m, _k1h and _k1n
+std::string getTraubMilesDerivativeCode(const std::string &state, const std::string &derivative)
+{
+    const std::string V = state.empty() ? "$(V)" : (state + "V");
+    const std::string m = state.empty() ? "$(m)" : (state + "m");
+    const std::string h = state.empty() ? "$(h)" : (state + "h");
+    const std::string n = state.empty() ? "$(n)" : (state + "n");
+
+    return "   scalar " + derivative + "V, " + derivative + "m, " + derivative + "h, " + derivative + "n;\n"
+        "   {\n"
+        "      " + derivative + "V= -(" + m + "*" + m + "*" + m + "*" + h + "*$(gNa)*(" + V + "-($(ENa)))+\n"
+        "          " + n + "*" + n + "*" + n + "*" + n + "*$(gK)*(" + V + "-($(EK)))+\n"
+        "          $(gl)*(" + V + "-($(El)))-$(Isyn))/$(C);\n"
+        "      scalar _a= (" + V + " == -52.0) ? 1.28 : 0.32*(-52.0-" + V + ")/(exp((-52.0-" + V + ")/4.0)-1.0);\n"
+        "      scalar _b= (" + V + " == -25.0) ? 1.4 : 0.28*(" + V + "+25.0)/(exp((" + V + "+25.0)/5.0)-1.0);\n"
+        "      " + derivative + "m= _a*(1.0-" + m + ")-_b*" + m + ";\n"
+        "      _a= 0.128*exp((-48.0-" + V + ")/18.0);\n"
+        "      _b= 4.0 / (exp((-25.0-" + V + ")/5.0)+1.0);\n"
+        "      " + derivative + "h= _a*(1.0-" + h + ")-_b*" + h + ";\n"
+        "      _a= (" + V + " == -50.0) ? 0.16 : 0.032*(-50.0-" + V + ")/(exp((-50.0-" + V + ")/5.0)-1.0);\n"
+        "      _b= 0.5*exp((-55.0-" + V + ")/40.0);\n"
+        "      " + derivative + "n= _a*(1.0-" + n + ")-_b*" + n + ";\n"
+        "   }\n";
+}
+
+//! Generate code declaring, for each of V, m, h and n, a variable prefixed by name
+//! and initialised to expression with every X replaced by the name of the variable
+std::string getTraubMilesStateCode(const std::string &name, const std::string &expression)
+{
+    std::string code;
+    for(const char *v : traubMilesStateVars) {
+        std::string e = expression;
+        substitute(e, "X", v);
+        code += "   const scalar " + name + v + "= " + e + ";\n";
+    }
+    return code;
+}
+
+//! Generate adaptive substepping loop around the code of one embedded Runge-Kutta step
+/*! The step code must declare _new and _err prefixed variables holding the new state and the error
+    estimate for each of V, m, h and n after a substep of length _hs. The substep is accepted if the
+    error is within errTol (or the substep cannot get any smaller) and the next substep is scaled
+    by the usual safety factor times (errTol / error)^(1 / order). Substeps shortened to end at the end
+    of the time step do not change the substep the next time step starts with if they are accepted. */
+std::string getTraubMilesAdaptiveCode(const std::string &stepCode, const std::string &order)
+{
+    return "scalar _h= ($(substep) > 0.0) ? fmin($(substep), DT) : DT;\n"
+        "scalar _tRem= DT;\n"
+        "while (_tRem > 0.0) {\n"
+        "   const scalar _hs= fmin(_h, _tRem);\n"
+        + stepCode +
+        "   const scalar _err= fmax(fabs(_errV), 100.0*fmax(fabs(_errm), fmax(fabs(_errh), fabs(_errn))));\n"
+        "   if (_err <= $(errTol) || _hs <= $(minSubstep)) {\n"
+        "      $(V)= _newV;\n"
+        "      $(m)= _newm;\n"
+        "      $(h)= _newh;\n"
+        "      $(n)= _newn;\n"
+        "      _tRem-= _hs;\n"
+        "   }\n"
+        "   if (_hs == _h || _err > $(errTol)) {\n"
+        "      _h= _hs*fmin(5.0, fmax(0.2, 0.9*pow($(errTol)/fmax(_err, SCALAR_MIN), " + order + ")));\n"
+        "      _h= fmin(DT, fmax($(minSubstep), _h));\n"
+        "   }\n"
+        "}\n"
+        "$(substep)= _h;\n";
+}
+}   // Anonymous namespace
+
 // Implement models
 IMPLEMENT_MODEL(NeuronModels::RulkovMap);
 IMPLEMENT_MODEL(NeuronModels::Izhikevich);
@@ -10,6 +87,9 @@ IMPLEMENT_MODEL(NeuronModels::TraubMiles);
 IMPLEMENT_MODEL(NeuronModels::TraubMilesFast);
 IMPLEMENT_MODEL(NeuronModels::TraubMilesAlt);
 IMPLEMENT_MODEL(NeuronModels::TraubMilesNStep);
+IMPLEMENT_MODEL(NeuronModels::TraubMilesAdaptive);
+IMPLEMENT_MODEL(NeuronModels::TraubMilesAdaptiveRK3);
+IMPLEMENT_MODEL(NeuronModels::LIF);
 
 //----------------------------------------------------------------------------
 // NeuronModels::LegacyWrapper
@@ -29,6 +109,11 @@ std::string NeuronModels::LegacyWrapper::getResetCode() const
     return nModels[m_LegacyTypeIndex].resetCode;
 }
 //----------------------------------------------------------------------------
+std::string NeuronModels::LegacyWrapper::getRestConditionCode() const
+{
+    return nModels[m_LegacyTypeIndex].restConditionCode;
+}
+//----------------------------------------------------------------------------
 std::string NeuronModels::LegacyWrapper::getSupportCode() const
 {
     return nModels[m_LegacyTypeIndex].supportCode;
@@ -44,4 +129,36 @@ bool NeuronModels::LegacyWrapper::isPoisson() const
 {
     return (m_LegacyTypeIndex == POISSONNEURON);
 }
+
+//----------------------------------------------------------------------------
+// NeuronModels::TraubMilesAdaptive
 //----------------------------------------------------------------------------
+std::string NeuronModels::TraubMilesAdaptive::getSimCode() const
+{
+    // Heun's method with the error estimated from the embedded Euler step
+    return getTraubMilesAdaptiveCode(
+        getTraubMilesDerivativeCode("", "_k1")
+        + getTraubMilesStateCode("_y2", "$(X) + _hs*_k1X")
+        + getTraubMilesDerivativeCode("_y2", "_k2")
+        + getTraubMilesStateCode("_new", "$(X) + 0.5*_hs*(_k1X + _k2X)")
+        + getTraubMilesStateCode("_err", "0.5*_hs*(_k2X - _k1X)"),
+        "1.0/2.0");
+}
+
+//----------------------------------------------------------------------------
+// NeuronModels::TraubMilesAdaptiveRK3
+//----------------------------------------------------------------------------
+std::string NeuronModels::TraubMilesAdaptiveRK3::getSimCode() const
+{
+    // Bogacki-Shampine method with the error estimated from the embedded second order step
+    return getTraubMilesAdaptiveCode(
+        getTraubMilesDerivativeCode("", "_k1")
+        + getTraubMilesStateCode("_y2", "$(X) + 0.5*_hs*_k1X")
+        + getTraubMilesDerivativeCode("_y2", "_k2")
+        + getTraubMilesStateCode("_y3", "$(X) + 0.75*_hs*_k2X")
+        + getTraubMilesDerivativeCode("_y3", "_k3")
+        + getTraubMilesStateCode("_new", "$(X) + _hs*((2.0/9.0)*_k1X + (1.0/3.0)*_k2X + (4.0/9.0)*_k3X)")
+        + getTraubMilesDerivativeCode("_new", "_k4")
+        + getTraubMilesStateCode("_err", "_hs*((-5.0/72.0)*_k1X + (1.0/12.0)*_k2X + (1.0/9.0)*_k3X - 0.125*_k4X)"),
+        "1.0/3.0");
+}
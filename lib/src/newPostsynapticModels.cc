@@ -3,6 +3,7 @@
 // Implement models
 IMPLEMENT_MODEL(PostsynapticModels::ExpCond);
 IMPLEMENT_MODEL(PostsynapticModels::DeltaCurr);
+IMPLEMENT_MODEL(PostsynapticModels::ExpCurr);
 
 //----------------------------------------------------------------------------
 // PostsynapticModels::LegacyWrapper
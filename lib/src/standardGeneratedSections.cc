@@ -39,7 +39,15 @@ void StandardGeneratedSections::neuronLocalVarInit(
     const std::string &devPrefix,
     const std::string &localID)
 {
-    for(const auto &v : nmVars.container) {
+    for(size_t i = 0; i < nmVars.container.size(); i++) {
+        const auto &v = nmVars.container[i];
+
+        // Variables promoted to constants are initialised with their value rather than read from memory
+        if (ng.isVarConstant(v.first)) {
+            os << "const " << v.second << " l" << v.first << " = " << valueToString(ng.getInitVals()[i]) << ";" << ENDL;
+            continue;
+        }
+
         os << v.second << " l" << v.first << " = ";
         os << devPrefix << v.first << ng.getName() << "[";
         if (ng.isVarQueueRequired(v.first) && ng.isDelayRequired()) {
@@ -58,7 +66,10 @@ void StandardGeneratedSections::neuronLocalVarWrite(
 {
     // store the defined parts of the neuron state into the global state variables dd_V etc
    for(const auto &v : nmVars.container) {
-        if (ng.isVarQueueRequired(v.first)) {
+        if (ng.isVarConstant(v.first)) {
+            continue;
+        }
+        else if (ng.isVarQueueRequired(v.first)) {
             os << devPrefix << v.first << ng.getName() << "[" << ng.getQueueOffset(devPrefix) << localID << "] = l" << v.first << ";" << ENDL;
         }
         else {
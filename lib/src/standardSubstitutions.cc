@@ -4,6 +4,46 @@
 #include "CodeHelper.h"
 #include "modelSpec.h"
 
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+//! Bind the parameters and derived parameters of neuron group ng to their values or, where they differ
+//! between merged neuron groups, to the fields of the merged group table entry being updated
+void addNeuronParamSubstitutions(CodeSubstitutions &substitutions, const NeuronGroup &ng,
+                                 const DerivedParamNameIterCtx &nmDerivedParams)
+{
+    const auto paramNames = ng.getNeuronModel()->getParamNames();
+    for(size_t i = 0; i < paramNames.size(); i++) {
+        if (ng.isParamHeterogeneous(i)) {
+            substitutions.addVarSubstitution(paramNames[i], "mergedGroup." + paramNames[i]);
+        }
+    }
+    size_t i = 0;
+    for(auto d = nmDerivedParams.nameBegin; d != nmDerivedParams.nameEnd; d++, i++) {
+        if (ng.isDerivedParamHeterogeneous(i)) {
+            substitutions.addVarSubstitution(*d, "mergedGroup." + *d);
+        }
+    }
+
+    substitutions.addParamSubstitutions(paramNames, ng.getParams(), ng.getRuntimeParams(), ng.getRuntimeParamsName());
+    substitutions.addParamSubstitutions(nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams(),
+                                        ng.getRuntimeParams(), ng.getRuntimeParamsName());
+}
+
+//! Bind the weight update model variables of synapse group sg which are promoted to constants to their initial values
+void addConstantWUVarSubstitutions(CodeSubstitutions &substitutions, const SynapseGroup &sg)
+{
+    const auto vars = sg.getWUModel()->getVars();
+    for(size_t i = 0; i < vars.size(); i++) {
+        if (sg.isWUVarConstant(vars[i].first)) {
+            substitutions.addVarSubstitution(vars[i].first, valueToString(sg.getWUInitVals()[i]));
+        }
+    }
+}
+}   // Anonymous namespace
+
 //----------------------------------------------------------------------------
 // StandardSubstitutions
 //----------------------------------------------------------------------------
@@ -20,26 +60,28 @@ void StandardSubstitutions::postSynapseCurrentConverter(
     auto psmVars = VarNameIterCtx(sg->getPSModel()->getVars());
     auto psmDerivedParams = DerivedParamNameIterCtx(sg->getPSModel()->getDerivedParams());
 
+    CodeSubstitutions substitutions;
+
     // Substitute in time parameter
-    substitute(psCode, "$(t)", "t");
+    substitutions.addVarSubstitution("t", "t");
 
-    name_substitutions(psCode, "l", nmVars.nameBegin, nmVars.nameEnd, "");
-    value_substitutions(psCode, ng.getNeuronModel()->getParamNames(), ng.getParams());
-    value_substitutions(psCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams());
+    substitutions.addNameSubstitutions("l", nmVars.nameBegin, nmVars.nameEnd, "");
+    addNeuronParamSubstitutions(substitutions, ng, nmDerivedParams);
 
     if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-        name_substitutions(psCode, "lps", psmVars.nameBegin, psmVars.nameEnd, sg->getName());
+        substitutions.addNameSubstitutions("lps", psmVars.nameBegin, psmVars.nameEnd, sg->getName());
     }
     else {
-        value_substitutions(psCode, psmVars.nameBegin, psmVars.nameEnd, sg->getPSInitVals());
+        substitutions.addValueSubstitutions(psmVars.nameBegin, psmVars.nameEnd, sg->getPSInitVals());
     }
-    value_substitutions(psCode, sg->getPSModel()->getParamNames(), sg->getPSParams());
+    substitutions.addValueSubstitutions(sg->getPSModel()->getParamNames(), sg->getPSParams());
 
     // Create iterators to iterate over the names of the postsynaptic model's derived parameters
-    value_substitutions(psCode, psmDerivedParams.nameBegin, psmDerivedParams.nameEnd, sg->getPSDerivedParams());
-    name_substitutions(psCode, "", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
+    substitutions.addValueSubstitutions(psmDerivedParams.nameBegin, psmDerivedParams.nameEnd, sg->getPSDerivedParams());
+    substitutions.addNameSubstitutions("", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
+    substitutions.applyChecked(psCode, "postSyntoCurrent");
+    substituteUpdatePeriodDT(psCode, ng.getUpdatePeriod());
     psCode = ensureFtype(psCode, ftype);
-    checkUnreplacedVariables(psCode, "postSyntoCurrent");
 }
 
 void StandardSubstitutions::postSynapseDecay(
@@ -55,17 +97,18 @@ void StandardSubstitutions::postSynapseDecay(
     auto psmVars = VarNameIterCtx(sg->getPSModel()->getVars());
     auto psmDerivedParams = DerivedParamNameIterCtx(sg->getPSModel()->getDerivedParams());
 
-    substitute(pdCode, "$(t)", "t");
+    CodeSubstitutions substitutions;
+    substitutions.addVarSubstitution("t", "t");
 
-    name_substitutions(pdCode, "lps", psmVars.nameBegin, psmVars.nameEnd, sg->getName());
-    value_substitutions(pdCode, sg->getPSModel()->getParamNames(), sg->getPSParams());
-    value_substitutions(pdCode, psmDerivedParams.nameBegin, psmDerivedParams.nameEnd, sg->getPSDerivedParams());
-    name_substitutions(pdCode, "l", nmVars.nameBegin, nmVars.nameEnd, "");
-    value_substitutions(pdCode, ng.getNeuronModel()->getParamNames(), ng.getParams());
-    value_substitutions(pdCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams());
+    substitutions.addNameSubstitutions("lps", psmVars.nameBegin, psmVars.nameEnd, sg->getName());
+    substitutions.addValueSubstitutions(sg->getPSModel()->getParamNames(), sg->getPSParams());
+    substitutions.addValueSubstitutions(psmDerivedParams.nameBegin, psmDerivedParams.nameEnd, sg->getPSDerivedParams());
+    substitutions.addNameSubstitutions("l", nmVars.nameBegin, nmVars.nameEnd, "");
+    addNeuronParamSubstitutions(substitutions, ng, nmDerivedParams);
 
+    substitutions.applyChecked(pdCode, "postSynDecay");
+    substituteUpdatePeriodDT(pdCode, ng.getUpdatePeriod());
     pdCode = ensureFtype(pdCode, ftype);
-    checkUnreplacedVariables(pdCode, "postSynDecay");
 }
 
 
@@ -77,15 +120,35 @@ void StandardSubstitutions::neuronThresholdCondition(
     const ExtraGlobalParamNameIterCtx &nmExtraGlobalParams,
     const std::string &ftype)
 {
-    substitute(thCode, "$(t)", "t");
-    name_substitutions(thCode, "l", nmVars.nameBegin, nmVars.nameEnd, "");
-    substitute(thCode, "$(Isyn)", "Isyn");
-    substitute(thCode, "$(sT)", "lsT");
-    value_substitutions(thCode, ng.getNeuronModel()->getParamNames(), ng.getParams());
-    value_substitutions(thCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams());
-    name_substitutions(thCode, "", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
-    thCode= ensureFtype(thCode, ftype);
-    checkUnreplacedVariables(thCode,"thresholdConditionCode");
+    CodeSubstitutions substitutions;
+    substitutions.addVarSubstitution("t", "t");
+    substitutions.addNameSubstitutions("l", nmVars.nameBegin, nmVars.nameEnd, "");
+    substitutions.addVarSubstitution("Isyn", "Isyn");
+    substitutions.addVarSubstitution("sT", "lsT");
+    addNeuronParamSubstitutions(substitutions, ng, nmDerivedParams);
+    substitutions.addNameSubstitutions("", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
+    substitutions.applyChecked(thCode, "thresholdConditionCode");
+    substituteUpdatePeriodDT(thCode, ng.getUpdatePeriod());
+    thCode = ensureFtype(thCode, ftype);
+}
+
+void StandardSubstitutions::neuronRestCondition(
+    std::string &rCode,
+    const NeuronGroup &ng,
+    const VarNameIterCtx &nmVars,
+    const DerivedParamNameIterCtx &nmDerivedParams,
+    const ExtraGlobalParamNameIterCtx &nmExtraGlobalParams,
+    const std::string &ftype)
+{
+    CodeSubstitutions substitutions;
+    substitutions.addVarSubstitution("t", "t");
+    substitutions.addNameSubstitutions("l", nmVars.nameBegin, nmVars.nameEnd, "");
+    substitutions.addVarSubstitution("Isyn", "Isyn");
+    addNeuronParamSubstitutions(substitutions, ng, nmDerivedParams);
+    substitutions.addNameSubstitutions("", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
+    substitutions.applyChecked(rCode, "restConditionCode");
+    substituteUpdatePeriodDT(rCode, ng.getUpdatePeriod());
+    rCode = ensureFtype(rCode, ftype);
 }
 
 void StandardSubstitutions::neuronSim(
@@ -96,15 +159,16 @@ void StandardSubstitutions::neuronSim(
     const ExtraGlobalParamNameIterCtx &nmExtraGlobalParams,
     const std::string &ftype)
 {
-    substitute(sCode, "$(t)", "t");
-    name_substitutions(sCode, "l", nmVars.nameBegin, nmVars.nameEnd, "");
-    value_substitutions(sCode, ng.getNeuronModel()->getParamNames(), ng.getParams());
-    value_substitutions(sCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams());
-    name_substitutions(sCode, "", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
-    substitute(sCode, "$(Isyn)", "Isyn");
-    substitute(sCode, "$(sT)", "lsT");
+    CodeSubstitutions substitutions;
+    substitutions.addVarSubstitution("t", "t");
+    substitutions.addNameSubstitutions("l", nmVars.nameBegin, nmVars.nameEnd, "");
+    addNeuronParamSubstitutions(substitutions, ng, nmDerivedParams);
+    substitutions.addNameSubstitutions("", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
+    substitutions.addVarSubstitution("Isyn", "Isyn");
+    substitutions.addVarSubstitution("sT", "lsT");
+    substitutions.applyChecked(sCode, "neuron simCode");
+    substituteUpdatePeriodDT(sCode, ng.getUpdatePeriod());
     sCode = ensureFtype(sCode, ftype);
-    checkUnreplacedVariables(sCode, "neuron simCode");
 }
 
 void StandardSubstitutions::neuronSpikeEventCondition(
@@ -114,12 +178,14 @@ void StandardSubstitutions::neuronSpikeEventCondition(
     const ExtraGlobalParamNameIterCtx &nmExtraGlobalParams,
     const std::string &ftype)
 {
+    CodeSubstitutions substitutions;
+
     // code substitutions ----
-    substitute(eCode, "$(t)", "t");
-    name_substitutions(eCode, "l", nmVars.nameBegin, nmVars.nameEnd, "", "_pre");
-    name_substitutions(eCode, "", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
+    substitutions.addVarSubstitution("t", "t");
+    substitutions.addNameSubstitutions("l", nmVars.nameBegin, nmVars.nameEnd, "", "_pre");
+    substitutions.addNameSubstitutions("", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
+    substitutions.applyChecked(eCode, "neuronSpkEvntCondition");
     eCode = ensureFtype(eCode, ftype);
-    checkUnreplacedVariables(eCode, "neuronSpkEvntCondition");
 }
 
 void StandardSubstitutions::neuronReset(
@@ -130,15 +196,16 @@ void StandardSubstitutions::neuronReset(
     const ExtraGlobalParamNameIterCtx &nmExtraGlobalParams,
     const std::string &ftype)
 {
-    substitute(rCode, "$(t)", "t");
-    name_substitutions(rCode, "l", nmVars.nameBegin, nmVars.nameEnd, "");
-    value_substitutions(rCode, ng.getNeuronModel()->getParamNames(), ng.getParams());
-    value_substitutions(rCode, nmDerivedParams.nameBegin, nmDerivedParams.nameEnd, ng.getDerivedParams());
-    substitute(rCode, "$(Isyn)", "Isyn");
-    substitute(rCode, "$(sT)", "lsT");
-    name_substitutions(rCode, "", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
+    CodeSubstitutions substitutions;
+    substitutions.addVarSubstitution("t", "t");
+    substitutions.addNameSubstitutions("l", nmVars.nameBegin, nmVars.nameEnd, "");
+    addNeuronParamSubstitutions(substitutions, ng, nmDerivedParams);
+    substitutions.addVarSubstitution("Isyn", "Isyn");
+    substitutions.addVarSubstitution("sT", "lsT");
+    substitutions.addNameSubstitutions("", nmExtraGlobalParams.nameBegin, nmExtraGlobalParams.nameEnd, ng.getName());
+    substitutions.applyChecked(rCode, "resetCode");
+    substituteUpdatePeriodDT(rCode, ng.getUpdatePeriod());
     rCode = ensureFtype(rCode, ftype);
-    checkUnreplacedVariables(rCode, "resetCode");
 }
 
 void StandardSubstitutions::weightUpdateThresholdCondition(
@@ -151,12 +218,15 @@ void StandardSubstitutions::weightUpdateThresholdCondition(
     const string &devPrefix,
     const std::string &ftype)
 {
-    value_substitutions(eCode, sg.getWUModel()->getParamNames(), sg.getWUParams());
-    value_substitutions(eCode, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg.getWUDerivedParams());
-    name_substitutions(eCode, "", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg.getName());
-    neuron_substitutions_in_synaptic_code(eCode, &sg, preIdx, postIdx, devPrefix);
-    eCode= ensureFtype(eCode, ftype);
-    checkUnreplacedVariables(eCode, "evntThreshold");
+    CodeSubstitutions substitutions;
+    substitutions.addParamSubstitutions(sg.getWUModel()->getParamNames(), sg.getWUParams(),
+                                        sg.getWURuntimeParams(), sg.getWURuntimeParamsName());
+    substitutions.addParamSubstitutions(wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg.getWUDerivedParams(),
+                                        sg.getWURuntimeParams(), sg.getWURuntimeParamsName());
+    substitutions.addNameSubstitutions("", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg.getName());
+    neuron_substitutions_in_synaptic_code(substitutions, &sg, preIdx, postIdx, devPrefix);
+    substitutions.applyChecked(eCode, "evntThreshold");
+    eCode = ensureFtype(eCode, ftype);
 }
 
 void StandardSubstitutions::weightUpdateSim(
@@ -170,17 +240,24 @@ void StandardSubstitutions::weightUpdateSim(
     const string &devPrefix,
     const std::string &ftype)
 {
+    CodeSubstitutions substitutions;
+
      if (sg.getMatrixType() & SynapseMatrixWeight::GLOBAL) {
-         value_substitutions(wCode, wuVars.nameBegin, wuVars.nameEnd, sg.getWUInitVals());
+         substitutions.addValueSubstitutions(wuVars.nameBegin, wuVars.nameEnd, sg.getWUInitVals());
+     }
+     else {
+         addConstantWUVarSubstitutions(substitutions, sg);
      }
 
-    value_substitutions(wCode, sg.getWUModel()->getParamNames(), sg.getWUParams());
-    value_substitutions(wCode, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg.getWUDerivedParams());
-    name_substitutions(wCode, "", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg.getName());
-    substitute(wCode, "$(addtoinSyn)", "addtoinSyn");
-    neuron_substitutions_in_synaptic_code(wCode, &sg, preIdx, postIdx, devPrefix);
-    wCode= ensureFtype(wCode, ftype);
-    checkUnreplacedVariables(wCode, "simCode");
+    substitutions.addParamSubstitutions(sg.getWUModel()->getParamNames(), sg.getWUParams(),
+                                        sg.getWURuntimeParams(), sg.getWURuntimeParamsName());
+    substitutions.addParamSubstitutions(wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg.getWUDerivedParams(),
+                                        sg.getWURuntimeParams(), sg.getWURuntimeParamsName());
+    substitutions.addNameSubstitutions("", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg.getName());
+    substitutions.addVarSubstitution("addtoinSyn", "addtoinSyn");
+    neuron_substitutions_in_synaptic_code(substitutions, &sg, preIdx, postIdx, devPrefix);
+    substitutions.applyChecked(wCode, "simCode");
+    wCode = ensureFtype(wCode, ftype);
 }
 
 void StandardSubstitutions::weightUpdateDynamics(
@@ -193,18 +270,26 @@ void StandardSubstitutions::weightUpdateDynamics(
     const string &devPrefix,
     const std::string &ftype)
 {
+    CodeSubstitutions substitutions;
+
      if (sg->getMatrixType() & SynapseMatrixWeight::GLOBAL) {
-         value_substitutions(SDcode, wuVars.nameBegin, wuVars.nameEnd, sg->getWUInitVals());
+         substitutions.addValueSubstitutions(wuVars.nameBegin, wuVars.nameEnd, sg->getWUInitVals());
+     }
+     else {
+         addConstantWUVarSubstitutions(substitutions, *sg);
      }
 
      // substitute parameter values for parameters in synapseDynamics code
-    value_substitutions(SDcode, sg->getWUModel()->getParamNames(), sg->getWUParams());
+    substitutions.addParamSubstitutions(sg->getWUModel()->getParamNames(), sg->getWUParams(),
+                                        sg->getWURuntimeParams(), sg->getWURuntimeParamsName());
 
     // substitute values for derived parameters in synapseDynamics code
-    value_substitutions(SDcode, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams());
-    neuron_substitutions_in_synaptic_code(SDcode, sg, preIdx, postIdx, devPrefix);
-    SDcode= ensureFtype(SDcode, ftype);
-    checkUnreplacedVariables(SDcode, "synapseDynamics");
+    substitutions.addParamSubstitutions(wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams(),
+                                        sg->getWURuntimeParams(), sg->getWURuntimeParamsName());
+    neuron_substitutions_in_synaptic_code(substitutions, sg, preIdx, postIdx, devPrefix);
+    substitutions.applyChecked(SDcode, "synapseDynamics");
+    substituteUpdatePeriodDT(SDcode, sg->getUpdatePeriod());
+    SDcode = ensureFtype(SDcode, ftype);
 }
 
 void StandardSubstitutions::weightUpdatePostLearn(
@@ -217,12 +302,16 @@ void StandardSubstitutions::weightUpdatePostLearn(
     const string &devPrefix,
     const std::string &ftype)
 {
-    value_substitutions(code, sg->getWUModel()->getParamNames(), sg->getWUParams());
-    value_substitutions(code, wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams());
-    name_substitutions(code, "", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg->getName());
+    CodeSubstitutions substitutions;
+    addConstantWUVarSubstitutions(substitutions, *sg);
+    substitutions.addParamSubstitutions(sg->getWUModel()->getParamNames(), sg->getWUParams(),
+                                        sg->getWURuntimeParams(), sg->getWURuntimeParamsName());
+    substitutions.addParamSubstitutions(wuDerivedParams.nameBegin, wuDerivedParams.nameEnd, sg->getWUDerivedParams(),
+                                        sg->getWURuntimeParams(), sg->getWURuntimeParamsName());
+    substitutions.addNameSubstitutions("", wuExtraGlobalParams.nameBegin, wuExtraGlobalParams.nameEnd, sg->getName());
 
     // presynaptic neuron variables and parameters
-    neuron_substitutions_in_synaptic_code(code, sg, preIdx, postIdx, devPrefix);
-    code= ensureFtype(code, ftype);
-    checkUnreplacedVariables(code, "simLearnPost");
+    neuron_substitutions_in_synaptic_code(substitutions, sg, preIdx, postIdx, devPrefix);
+    substitutions.applyChecked(code, "simLearnPost");
+    code = ensureFtype(code, ftype);
 }
\ No newline at end of file
@@ -52,6 +52,84 @@ void SynapseGroup::setPSVarZeroCopyEnabled(const std::string &var, bool enabled)
     }
 }
 
+void SynapseGroup::setUpdatePeriod(unsigned int numSteps)
+{
+    if (numSteps == 0) {
+        gennError("The update period of synapse group " + getName() + " must be at least one time step");
+    }
+    m_UpdatePeriod = numSteps;
+}
+
+void SynapseGroup::setPSLazyDecayEnabled(bool enabled)
+{
+    if (enabled) {
+        // Only decay which multiplies the input of every neuron by the same factor can be shared by the whole group
+        const auto *psm = getPSModel();
+        DerivedParamNameIterCtx psmDerivedParams(psm->getDerivedParams());
+        std::vector<std::string> paramNames = psm->getParamNames();
+        paramNames.insert(paramNames.end(), psmDerivedParams.nameBegin, psmDerivedParams.nameEnd);
+        if (!isExponentialDecayCode(psm->getDecayCode(), paramNames)) {
+            gennError("Lazy postsynaptic decay cannot be enabled for synapse group " + getName() + " as its postsynaptic model does not decay its input exponentially");
+        }
+
+        // The stored input is scaled so it can only be read by the current converter and added to through $(updatelinsyn)
+        const auto *wu = getWUModel();
+        std::string simCode = wu->getSimCode();
+        std::string eventCode = wu->getEventCode();
+        substitute(simCode, "$(updatelinsyn)", "");
+        substitute(eventCode, "$(updatelinsyn)", "");
+        if (isVarAssigned(psm->getCurrentConverterCode(), "inSyn")
+            || simCode.find("$(inSyn)") != std::string::npos || eventCode.find("$(inSyn)") != std::string::npos)
+        {
+            gennError("Lazy postsynaptic decay cannot be enabled for synapse group " + getName() + " as its models access its input other than through $(updatelinsyn) and the current converter");
+        }
+    }
+    m_PSLazyDecayEnabled = enabled;
+}
+
+void SynapseGroup::setDendriticDelay(const std::string &varName, unsigned int maxDelaySteps)
+{
+    // The delay is a variable of each synapse
+    VarNameIterCtx wuVars(getWUModel()->getVars());
+    if (find(wuVars.nameBegin, wuVars.nameEnd, varName) == wuVars.nameEnd) {
+        gennError("Cannot find variable " + varName);
+    }
+    if (!(getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)) {
+        gennError("Dendritic delays of synapse group " + getName() + " require individual weight update model variables");
+    }
+    if (maxDelaySteps == 0) {
+        gennError("The maximum dendritic delay of synapse group " + getName() + " must be at least one time step");
+    }
+
+    // Input which does not go through $(updatelinsyn) would bypass the ring buffer
+    const auto *wu = getWUModel();
+    if (wu->getSimCode().find("$(inSyn)") != std::string::npos || wu->getEventCode().find("$(inSyn)") != std::string::npos) {
+        gennError("Dendritic delays cannot be used by synapse group " + getName() + " as its weight update model accesses its input other than through $(updatelinsyn)");
+    }
+    m_DendriticDelayVar = varName;
+    m_MaxDendriticDelaySteps = maxDelaySteps;
+}
+
+void SynapseGroup::setWUParamRuntimeEnabled(const std::string &param, bool enabled)
+{
+    // If named parameter doesn't exist give error
+    const auto paramNames = getWUModel()->getParamNames();
+    if(find(paramNames.begin(), paramNames.end(), param) == paramNames.end()) {
+        gennError("Cannot find parameter " + param);
+    }
+    // Otherwise add name of parameter to set
+    else {
+        // If enabled, add parameter to set
+        if(enabled) {
+            m_WURuntimeParams.insert(param);
+        }
+        // Otherwise, remove it
+        else {
+            m_WURuntimeParams.erase(param);
+        }
+    }
+}
+
 void SynapseGroup::setMaxConnections(unsigned int maxConnections)
 {
      if (getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
@@ -81,15 +159,24 @@ void SynapseGroup::initDerivedParams(double dt)
     m_WUDerivedParams.reserve(wuDerivedParams.size());
     m_PSDerivedParams.reserve(psDerivedParams.size());
 
+    // Derived parameters are calculated for the time advanced by in each update - the synapse dynamics
+    // of this group for the weight update model and the postsynaptic neuron update for the postsynaptic model
+    const double wuDT = dt * getUpdatePeriod();
+    const double psDT = dt * getTrgNeuronGroup()->getUpdatePeriod();
+
     // Loop through derived parameters
     for(const auto &d : wuDerivedParams) {
-        m_WUDerivedParams.push_back(d.second(m_WUParams, dt));
+        m_WUDerivedParams.push_back(d.second(m_WUParams, wuDT));
     }
 
     // Loop through derived parameters
     for(const auto &d : psDerivedParams) {
-        m_PSDerivedParams.push_back(d.second(m_PSParams, dt));
+        m_PSDerivedParams.push_back(d.second(m_PSParams, psDT));
     }
+
+    // Keep weight update derived parameters which depend on runtime parameters as runtime values too
+    addRuntimeDerivedParams(getName(), getWUModel()->getParamNames(), m_WUParams, wuDerivedParams, m_WUDerivedParams,
+                            wuDT, m_WURuntimeParams);
 }
 
 void SynapseGroup::calcKernelSizes(unsigned int blockSize, unsigned int &paddedKernelIDStart)
@@ -153,6 +240,35 @@ bool SynapseGroup::isPSVarZeroCopyEnabled(const std::string &var) const
     return (m_PSVarZeroCopyEnabled.find(var) != std::end(m_PSVarZeroCopyEnabled));
 }
 
+bool SynapseGroup::isWUCodeWriting(const std::string &name) const
+{
+    const auto *wu = getWUModel();
+    return (isVarAssigned(wu->getSimCode(), name) || isVarAssigned(wu->getEventCode(), name)
+            || isVarAssigned(wu->getEventThresholdConditionCode(), name) || isVarAssigned(wu->getLearnPostCode(), name)
+            || isVarAssigned(wu->getSynapseDynamicsCode(), name));
+}
+
+bool SynapseGroup::isWUVarConstant(const std::string &var) const
+{
+    return (m_ConstantWUVars.find(var) != std::end(m_ConstantWUVars));
+}
+
+NewModels::Base::StringPairVec SynapseGroup::getNonConstantWUVars() const
+{
+    NewModels::Base::StringPairVec vars;
+    for(const auto &v : getWUModel()->getVars()) {
+        if(!isWUVarConstant(v.first)) {
+            vars.push_back(v);
+        }
+    }
+    return vars;
+}
+
+bool SynapseGroup::isWUParamRuntimeEnabled(const std::string &param) const
+{
+    return (m_WURuntimeParams.find(param) != std::end(m_WURuntimeParams));
+}
+
 bool SynapseGroup::isPSAtomicAddRequired(unsigned int blockSize) const
 {
     if (getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
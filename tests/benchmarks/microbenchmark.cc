@@ -0,0 +1,271 @@
+// C++ standard includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+// C standard includes
+#include <cstdio>
+#include <cstdlib>
+
+// GeNN includes
+#include "codeGenUtils.h"
+#include "sparseProjection.h"
+#include "sparseUtils.h"
+
+//--------------------------------------------------------------------------
+// Allocation counting
+//--------------------------------------------------------------------------
+// Every heap allocation made by the process goes through these replacements
+// so benchmarks can report allocations per operation alongside timings
+namespace
+{
+std::atomic<unsigned long long> g_NumAllocations(0);
+std::atomic<unsigned long long> g_NumAllocatedBytes(0);
+}
+
+void *operator new(size_t size)
+{
+    g_NumAllocations++;
+    g_NumAllocatedBytes += size;
+    void *ptr = malloc((size == 0) ? 1 : size);
+    if(ptr == NULL) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+namespace
+{
+//--------------------------------------------------------------------------
+// Benchmark harness
+//--------------------------------------------------------------------------
+//! Minimum wall-clock time each benchmark is repeated for
+const double minBenchmarkSeconds = 0.5;
+
+//! Run setup and op repeatedly until minBenchmarkSeconds has elapsed and print ns, allocations and bytes per op
+/*! Only the time and allocations of op are measured - setup can be used to
+    restore input state (e.g. a fresh copy of a code string) between repetitions */
+template<typename Setup, typename Op>
+void benchmark(const std::string &name, const std::string &size, unsigned long long itemsPerOp, Setup setup, Op op)
+{
+    double totalSeconds = 0.0;
+    unsigned long long numOps = 0;
+    unsigned long long numAllocations = 0;
+    unsigned long long numBytes = 0;
+    while(totalSeconds < minBenchmarkSeconds || numOps == 0) {
+        setup();
+
+        const unsigned long long allocationsBefore = g_NumAllocations;
+        const unsigned long long bytesBefore = g_NumAllocatedBytes;
+        const auto start = std::chrono::steady_clock::now();
+        op();
+        const auto end = std::chrono::steady_clock::now();
+        numAllocations += g_NumAllocations - allocationsBefore;
+        numBytes += g_NumAllocatedBytes - bytesBefore;
+
+        totalSeconds += std::chrono::duration<double>(end - start).count();
+        numOps++;
+    }
+
+    const double nsPerOp = 1.0E9 * totalSeconds / (double)numOps;
+    printf("%-28s %-22s %16.1f %12.3f %14.1f %14.1f\n", name.c_str(), size.c_str(), nsPerOp,
+           nsPerOp / (double)itemsPerOp, (double)numAllocations / (double)numOps, (double)numBytes / (double)numOps);
+}
+
+//--------------------------------------------------------------------------
+// Input generation
+//--------------------------------------------------------------------------
+//! Simple deterministic linear congruential generator so inputs are identical between runs
+class LCG
+{
+public:
+    LCG(unsigned long long seed) : m_State(seed){}
+
+    unsigned int operator()(unsigned int max)
+    {
+        m_State = (m_State * 6364136223846793005ULL) + 1442695040888963407ULL;
+        return (unsigned int)((m_State >> 33) % max);
+    }
+
+private:
+    unsigned long long m_State;
+};
+
+//! Build a code string resembling generated neuron/synapse code with numStatements
+//! statements referencing numNames different $(name) targets and numeric constants
+std::string createCode(unsigned int numStatements, const std::vector<std::string> &names)
+{
+    LCG rng(1234);
+    std::string code;
+    for(unsigned int i = 0; i < numStatements; i++) {
+        const std::string &a = names[rng((unsigned int)names.size())];
+        const std::string &b = names[rng((unsigned int)names.size())];
+        const std::string &c = names[rng((unsigned int)names.size())];
+        code += "$(" + a + ") += DT * (0.04 * $(" + b + ") * $(" + b + ") + 5.0 * $(" + c + ") + 140.0 - exp(-$(" + a + ") / 1.5e-3));\n";
+    }
+    return code;
+}
+
+std::vector<std::string> createNames(unsigned int numNames)
+{
+    std::vector<std::string> names;
+    names.reserve(numNames);
+    for(unsigned int i = 0; i < numNames; i++) {
+        names.push_back("var" + std::to_string(i));
+    }
+    return names;
+}
+
+//! Fill C's forward CSR structure (indInG and ind) with numSynapses synapses spread evenly over preN rows
+void createCSR(unsigned int preN, unsigned int postN, unsigned long long numSynapses, SparseProjection &C)
+{
+    LCG rng(4321);
+    const unsigned int rowLength = (unsigned int)(numSynapses / preN);
+    C.indInG = new unsigned int[preN + 1];
+    C.ind = new unsigned int[numSynapses];
+    C.connN = (unsigned int)numSynapses;
+
+    C.indInG[0] = 0;
+    for(unsigned int i = 0; i < preN; i++) {
+        C.indInG[i + 1] = C.indInG[i] + rowLength;
+
+        // Random postsynaptic targets, sorted within each row as the GeNN tools produce them
+        unsigned int *row = &C.ind[C.indInG[i]];
+        for(unsigned int j = 0; j < rowLength; j++) {
+            row[j] = rng(postN);
+        }
+        std::sort(row, row + rowLength);
+    }
+
+    C.preInd = new unsigned int[numSynapses];
+    C.revIndInG = new unsigned int[postN + 1];
+    C.revInd = new unsigned int[numSynapses];
+    C.remap = new unsigned int[numSynapses];
+}
+
+void freeCSR(SparseProjection &C)
+{
+    delete[] C.indInG;
+    delete[] C.ind;
+    delete[] C.preInd;
+    delete[] C.revIndInG;
+    delete[] C.revInd;
+    delete[] C.remap;
+}
+
+//--------------------------------------------------------------------------
+// Benchmarks
+//--------------------------------------------------------------------------
+void benchmarkCodeGenUtils(unsigned int numStatements, unsigned int numNames)
+{
+    const std::vector<std::string> names = createNames(numNames);
+    const std::vector<double> values(numNames, 0.1);
+    const std::string original = createCode(numStatements, names);
+    const std::string size = std::to_string(original.size()) + "B/" + std::to_string(numNames) + "names";
+    std::string code;
+
+    // Single target which occurs many times
+    benchmark("substitute", size, 1,
+              [&code, &original](){ code = original; },
+              [&code](){ substitute(code, "$(var0)", "lvar0"); });
+
+    // Every name replaced with a local variable as in the generated neuron update
+    benchmark("name_substitutions", size, numNames,
+              [&code, &original](){ code = original; },
+              [&code, &names](){ name_substitutions(code, "l", names, ""); });
+
+    // Every name replaced with a parameter value
+    benchmark("value_substitutions", size, numNames,
+              [&code, &original](){ code = original; },
+              [&code, &names, &values](){ value_substitutions(code, names, values); });
+
+    // Every name replaced in a single pass, as in the standard substitutions
+    benchmark("CodeSubstitutions::apply", size, numNames,
+              [&code, &original](){ code = original; },
+              [&code, &names](){
+                  CodeSubstitutions substitutions;
+                  substitutions.addNameSubstitutions("l", names, "");
+                  substitutions.apply(code);
+              });
+
+    // Constants converted to single precision after all names have been replaced
+    std::string substituted = original;
+    name_substitutions(substituted, "l", names, "");
+    benchmark("ensureFtype", std::to_string(substituted.size()) + "B", substituted.size(),
+              [](){},
+              [&code, &substituted](){ code = ensureFtype(substituted, "float"); });
+}
+
+void benchmarkSparseUtils(unsigned long long numSynapses)
+{
+    // Square-ish projection with 1000 synapses per presynaptic neuron, as in the Izh_sparse example
+    const unsigned int rowLength = 1000;
+    const unsigned int preN = (unsigned int)std::max(1ULL, numSynapses / rowLength);
+    const unsigned int postN = preN;
+    const std::string size = std::to_string(numSynapses) + "syn";
+
+    SparseProjection C;
+    createCSR(preN, postN, (unsigned long long)preN * rowLength, C);
+
+    benchmark("createPreIndices", size, C.connN,
+              [](){},
+              [&C, preN, postN](){ createPreIndices(preN, postN, &C); });
+    benchmark("createPosttoPreArray", size, C.connN,
+              [](){},
+              [&C, preN, postN](){ createPosttoPreArray(preN, postN, &C); });
+
+    freeCSR(C);
+}
+}   // Anonymous namespace
+
+//--------------------------------------------------------------------------
+/*! \brief Entry point - usage: microbenchmark [max synapses]
+
+    Sparse utilities are benchmarked on CSR structures with 10^6 synapses up to
+    max synapses (default 10^7) in powers of ten. 10^9 synapses need around 40GB of RAM.
+ */
+//--------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const unsigned long long maxSynapses = (argc > 1) ? strtoull(argv[1], NULL, 10) : 10000000ULL;
+
+    printf("%-28s %-22s %16s %12s %14s %14s\n", "benchmark", "size", "ns/op", "ns/item", "allocs/op", "bytes/op");
+
+    // Typical single model snippet and a large merged code string
+    benchmarkCodeGenUtils(20, 10);
+    benchmarkCodeGenUtils(2000, 200);
+
+    for(unsigned long long n = 1000000ULL; n <= maxSynapses; n *= 10) {
+        benchmarkSparseUtils(n);
+    }
+    return EXIT_SUCCESS;
+}
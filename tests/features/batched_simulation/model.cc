@@ -0,0 +1,58 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[2] = {
+    0.0, // 0 - the input
+    0.0  // 1 - individual shift
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[1]= {
+    0.0 // 0 - the weight
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("batched_simulation");
+    model.setBatchSize(4);
+
+    neuronModel n;
+    n.varNames = {"x", "shift"};
+    n.varTypes = {"scalar", "scalar"};
+    n.simCode= "$(x) += $(shift) + $(Isyn);\n";
+    n.thresholdConditionCode = "$(x) >= 10.0";
+    n.resetCode = "$(x) = 0.0;\n";
+
+    const int DUMMYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    weightUpdateModel s;
+    s.varNames = {"g"};
+    s.varTypes = {"scalar"};
+    s.simCode= "$(addtoinSyn) = $(g);\n$(updatelinsyn);\n";
+
+    const int DUMMYSYNAPSE= weightUpdateModels.size();
+    weightUpdateModels.push_back(s);
+
+    model.addNeuronPopulation("Stim", 4, SPIKESOURCE, NULL, NULL);
+    model.addNeuronPopulation("Pop", 3, DUMMYNEURON, NULL, neuron_ini);
+
+    model.addSynapsePopulation("Dense", DUMMYSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "Pop",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+    model.addSynapsePopulation("Sparse", DUMMYSYNAPSE, SPARSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "Pop",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,62 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE("$(x) += $(shift) + $(Isyn);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("$(x) >= 10.0");
+
+    SET_RESET_CODE("$(x) = 0.0;\n");
+
+    SET_VARS({{"x", "scalar"}, {"shift", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SIM_CODE(
+        "$(addtoinSyn) = $(g);\n"
+        "$(updatelinsyn);\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("batched_simulation_new");
+    model.setBatchSize(4);
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Stim", 4, {}, {});
+    model.addNeuronPopulation<Neuron>("Pop", 3, {}, Neuron::VarValues(0.0, 0.0));
+
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Dense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Pop",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {});
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Sparse", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Stim", "Pop",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,121 @@
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Connect each stimulus neuron to one postsynaptic neuron
+        allocateSparse(4);
+        for(unsigned int i = 0; i < 4; i++) {
+            CSparse.indInG[i] = i;
+            CSparse.ind[i] = i % 3;
+        }
+        CSparse.indInG[4] = 4;
+
+        // Give every synapse a different weight in every instance
+        for(unsigned int b = 0; b < BATCH_SIZE; b++) {
+            for(unsigned int i = 0; i < 4; i++) {
+                for(unsigned int j = 0; j < 3; j++) {
+                    gDense[(((i * 3) + j) * BATCH_SIZE) + b] = (0.0625f * (float)(i + 1)) + (0.125f * (float)j) + (0.25f * (float)b);
+                }
+                gSparse[(i * BATCH_SIZE) + b] = 0.125f * (float)(b + 1);
+            }
+        }
+    }
+};
+
+TEST_P(SimTest, InstancesHaveSeparateState)
+{
+    ASSERT_EQ(BATCH_SIZE, 4);
+
+    // Each instance is driven by a different constant shift so its neurons spike at a different rate
+    for(unsigned int n = 0; n < 3; n++) {
+        for(unsigned int b = 0; b < BATCH_SIZE; b++) {
+            shiftPop[(n * BATCH_SIZE) + b] = (float)(b + 1);
+        }
+    }
+
+    float x[BATCH_SIZE] = {0.0f};
+    for(unsigned int t = 0; t < 20; t++) {
+        for(unsigned int b = 0; b < BATCH_SIZE; b++) {
+            glbSpkCntStim[b] = 0;
+        }
+
+        StepGeNN();
+
+        for(unsigned int b = 0; b < BATCH_SIZE; b++) {
+            x[b] += (float)(b + 1);
+            const bool spike = (x[b] >= 10.0f);
+            if(spike) {
+                x[b] = 0.0f;
+            }
+
+            for(unsigned int n = 0; n < 3; n++) {
+                ASSERT_FLOAT_EQ(xPop[(n * BATCH_SIZE) + b], x[b]) << "instance " << b;
+            }
+            ASSERT_EQ(glbSpkCntPop[b], spike ? 3u : 0u) << "instance " << b;
+            if(spike) {
+                for(unsigned int i = 0; i < 3; i++) {
+                    ASSERT_EQ(glbSpkPop[(b * 3) + i], i);
+                }
+            }
+        }
+    }
+}
+
+TEST_P(SimTest, InstancesReceiveTheirOwnSpikes)
+{
+    // **NOTE** the weights are small enough for no neuron to reach the threshold
+    float x[3][BATCH_SIZE] = {{0.0f}};
+    for(unsigned int t = 0; t < 5; t++) {
+        // In instance b, stimulus neuron b spikes
+        for(unsigned int b = 0; b < BATCH_SIZE; b++) {
+            glbSpkCntStim[b] = 1;
+            glbSpkStim[b * 4] = b;
+        }
+
+        StepGeNN();
+
+        for(unsigned int b = 0; b < BATCH_SIZE; b++) {
+            for(unsigned int j = 0; j < 3; j++) {
+                x[j][b] += gDense[(((b * 3) + j) * BATCH_SIZE) + b];
+                if(CSparse.ind[b] == j) {
+                    x[j][b] += gSparse[(b * BATCH_SIZE) + b];
+                }
+                ASSERT_FLOAT_EQ(xPop[(j * BATCH_SIZE) + b], x[j][b]) << "neuron " << j << " instance " << b;
+            }
+        }
+    }
+
+    // Every instance has its own elements in the state arrays
+    EXPECT_EQ(getVarDescriptor("x", "Pop")->getCount(), 3u * BATCH_SIZE);
+    EXPECT_EQ(getVarDescriptor("glbSpkCnt", "Pop")->getCount(), BATCH_SIZE);
+    EXPECT_EQ(getVarDescriptor("g", "Dense")->getCount(), 12u * BATCH_SIZE);
+    EXPECT_EQ(getVarDescriptor("g", "Sparse")->getCount(), 4u * BATCH_SIZE);
+    EXPECT_EQ(getVarDescriptor("ind", "Sparse")->getCount(), 4u);
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
@@ -0,0 +1,53 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[2] = {
+    0.0, // 0 - the input
+    2.0  // 1 - constant drive, never written
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[1]= {
+    0.5 // 0 - the weight, never written
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+    GENN_PREFERENCES::promoteConstantVars = true;
+
+    model.setDT(0.1);
+    model.setName("constant_vars");
+
+    neuronModel n;
+    n.varNames = {"x", "shift"};
+    n.varTypes = {"scalar", "scalar"};
+    n.simCode= "$(x) += $(shift) + $(Isyn);\n";
+
+    const int DUMMYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    weightUpdateModel s;
+    s.varNames = {"g"};
+    s.varTypes = {"scalar"};
+    s.simCode= "$(addtoinSyn) = $(g) * $(shift_post);\n$(updatelinsyn);\n";
+
+    const int DUMMYSYNAPSE= weightUpdateModels.size();
+    weightUpdateModels.push_back(s);
+
+    model.addNeuronPopulation("Stim", 1, SPIKESOURCE, NULL, NULL);
+    model.addNeuronPopulation("Pop", 10, DUMMYNEURON, NULL, neuron_ini);
+
+    model.addSynapsePopulation("Syn", DUMMYSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "Pop",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
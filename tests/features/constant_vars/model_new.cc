@@ -0,0 +1,54 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE("$(x) += $(shift) + $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}, {"shift", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SIM_CODE(
+        "$(addtoinSyn) = $(g) * $(shift_post);\n"
+        "$(updatelinsyn);\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+    GENN_PREFERENCES::promoteConstantVars = true;
+
+    model.setDT(0.1);
+    model.setName("constant_vars_new");
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Stim", 1, {}, {});
+    model.addNeuronPopulation<Neuron>("Pop", 10, {}, Neuron::VarValues(0.0, 2.0));
+
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Pop",
+        {}, WeightUpdateModel::VarValues(0.5),
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
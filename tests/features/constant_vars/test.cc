@@ -0,0 +1,59 @@
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+// Variables promoted to constants have no arrays so these
+// declarations would conflict if the generated code declared them
+static const int shiftPop = 0;
+static const int gSyn = 0;
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+    }
+};
+
+TEST_P(SimTest, UsesInitialValuesOfPromotedVariables)
+{
+    // Each step every neuron is driven by its constant shift and the spike arriving through the synapse group
+    float x = 0.0f;
+    for(unsigned int i = 0; i < 20; i++)
+    {
+        glbSpkCntStim[0] = 1;
+        glbSpkStim[0] = 0;
+
+        StepGeNN();
+
+        x += 2.0f + (0.5f * 2.0f);
+        for(unsigned int n = 0; n < 10; n++) {
+            ASSERT_FLOAT_EQ(xPop[n], x);
+        }
+    }
+
+    EXPECT_EQ(shiftPop, 0);
+    EXPECT_EQ(gSyn, 0);
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
@@ -0,0 +1,63 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[2] = {
+    0.0, // 0 - counter read with delay
+    0.0  // 1 - counter read without delay
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[1]= {
+    0.0 // 0 - the copied counter
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(1.0);
+    model.setName("delay_queues");
+
+    neuronModel n;
+    n.varNames = {"x", "y"};
+    n.varTypes = {"scalar", "scalar"};
+    n.simCode= "$(x)= $(x) + 1.0;\n$(y)= $(y) + 1.0;\n";
+    n.thresholdConditionCode= "$(x) > 0.0";
+
+    const int DUMMYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    weightUpdateModel sx;
+    sx.varNames = {"w"};
+    sx.varTypes = {"scalar"};
+    sx.simCode= "$(w)= $(x_pre);\n";
+    const int COPYXSYNAPSE= weightUpdateModels.size();
+    weightUpdateModels.push_back(sx);
+
+    weightUpdateModel sy;
+    sy.varNames = {"w"};
+    sy.varTypes = {"scalar"};
+    sy.simCode= "$(w)= $(y_pre);\n";
+    const int COPYYSYNAPSE= weightUpdateModels.size();
+    weightUpdateModels.push_back(sy);
+
+    model.addNeuronPopulation("Pre", 4, DUMMYNEURON, NULL, neuron_ini);
+    model.addNeuronPopulation("Post", 4, DUMMYNEURON, NULL, neuron_ini);
+
+    // Only x is read with a delay so y is not queued even though Pre needs delay slots
+    model.addSynapsePopulation("Delayed", COPYXSYNAPSE, DENSE, INDIVIDUALG, 5, IZHIKEVICH_PS, "Pre", "Post",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+    model.addSynapsePopulation("Direct", COPYYSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Pre", "Post",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,75 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE(
+        "$(x)= $(x) + 1.0;\n"
+        "$(y)= $(y) + 1.0;\n");
+
+    SET_THRESHOLD_CONDITION_CODE("$(x) > 0.0");
+
+    SET_VARS({{"x", "scalar"}, {"y", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// CopyX
+//----------------------------------------------------------------------------
+class CopyX : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(CopyX, 0, 1);
+
+    SET_VARS({{"w", "scalar"}});
+
+    SET_SIM_CODE("$(w)= $(x_pre);\n");
+};
+
+IMPLEMENT_MODEL(CopyX);
+
+//----------------------------------------------------------------------------
+// CopyY
+//----------------------------------------------------------------------------
+class CopyY : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(CopyY, 0, 1);
+
+    SET_VARS({{"w", "scalar"}});
+
+    SET_SIM_CODE("$(w)= $(y_pre);\n");
+};
+
+IMPLEMENT_MODEL(CopyY);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(1.0);
+    model.setName("delay_queues_new");
+
+    model.addNeuronPopulation<Neuron>("Pre", 4, {}, Neuron::VarValues(0.0, 0.0));
+    model.addNeuronPopulation<Neuron>("Post", 4, {}, Neuron::VarValues(0.0, 0.0));
+
+    // Only x is read with a delay so y is not queued even though Pre needs delay slots
+    model.addSynapsePopulation<CopyX, PostsynapticModels::DeltaCurr>(
+        "Delayed", SynapseMatrixType::DENSE_INDIVIDUALG, 5, "Pre", "Post",
+        {}, CopyX::VarValues(0.0),
+        {}, {});
+    model.addSynapsePopulation<CopyY, PostsynapticModels::DeltaCurr>(
+        "Direct", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, CopyY::VarValues(0.0),
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
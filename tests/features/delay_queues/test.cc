@@ -0,0 +1,70 @@
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+    }
+};
+
+TEST_P(SimTest, DelayedReadsSeeOldValues)
+{
+    for(unsigned int s = 1; s <= 30; s++) {
+        StepGeNN();
+
+        // Pre spikes on every time step and both counters equal the number of updates so far
+        for(unsigned int i = 0; i < 16; i++) {
+            if (s > 6) {
+                ASSERT_FLOAT_EQ(wDelayed[i], (float)(s - 5)) << "step " << s;
+            }
+            ASSERT_FLOAT_EQ(wDirect[i], (float)(s - 1)) << "step " << s;
+        }
+    }
+}
+
+TEST_P(SimTest, SlotsAreRoundedToPowerOfTwo)
+{
+    // A delay of 5 time steps needs 6 slots which are rounded up to 8
+    for(unsigned int s = 1; s <= 20; s++) {
+        StepGeNN();
+        ASSERT_EQ(spkQuePtrPre, s % 8) << "step " << s;
+    }
+}
+
+TEST_P(SimTest, OnlyDelayedVariablesAreQueued)
+{
+    for(unsigned int s = 1; s <= 20; s++) {
+        StepGeNN();
+
+        // x is written to the current slot of its queue whereas y is a single array
+        for(unsigned int i = 0; i < 4; i++) {
+            ASSERT_FLOAT_EQ(xPre[(spkQuePtrPre * 4) + i], (float)s) << "step " << s;
+            ASSERT_FLOAT_EQ(yPre[i], (float)s) << "step " << s;
+        }
+    }
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
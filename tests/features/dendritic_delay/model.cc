@@ -0,0 +1,54 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[1] = {
+    0.0 // 0 - the input
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[2]= {
+    0.0, // 0 - the weight
+    0.0  // 1 - the delay in time steps
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(1.0);
+    model.setName("dendritic_delay");
+
+    neuronModel n;
+    n.varNames = {"x"};
+    n.varTypes = {"scalar"};
+    n.simCode= "$(x)= $(Isyn);\n";
+
+    const int DUMMYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    weightUpdateModel s;
+    s.varNames = {"g", "d"};
+    s.varTypes = {"scalar", "unsigned int"};
+    s.simCode= "$(addtoinSyn) = $(g);\n$(updatelinsyn);\n";
+    const int DELAYSYNAPSE= weightUpdateModels.size();
+    weightUpdateModels.push_back(s);
+
+    model.addNeuronPopulation("Stim", 1, SPIKESOURCE, NULL, NULL);
+    model.addNeuronPopulation("Post", 4, DUMMYNEURON, NULL, neuron_ini);
+
+    SynapseGroup *syn = model.addSynapsePopulation("Syn", DELAYSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "Post",
+                                                   synapses_ini, NULL,
+                                                   NULL, NULL);
+
+    // The input of each synapse arrives d time steps after the spike
+    syn->setDendriticDelay("d", 8);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
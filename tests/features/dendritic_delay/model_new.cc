@@ -0,0 +1,56 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 2);
+
+    SET_VARS({{"g", "scalar"}, {"d", "unsigned int"}});
+
+    SET_SIM_CODE(
+        "$(addtoinSyn) = $(g);\n"
+        "$(updatelinsyn);\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(1.0);
+    model.setName("dendritic_delay_new");
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Stim", 1, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 4, {}, Neuron::VarValues(0.0));
+
+    SynapseGroup *syn = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Post",
+        {}, WeightUpdateModel::VarValues(0.0, 0.0),
+        {}, {});
+
+    // The input of each synapse arrives d time steps after the spike
+    syn->setDendriticDelay("d", 8);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,82 @@
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Each synapse has its own weight and delay
+        for(unsigned int i = 0; i < 4; i++) {
+            gSyn[i] = 1.0f + (float)i;
+            dSyn[i] = 2 * i;
+        }
+    }
+
+protected:
+    //----------------------------------------------------------------------------
+    // Protected methods
+    //----------------------------------------------------------------------------
+    void StepGeNN(bool stimSpike)
+    {
+        glbSpkCntStim[0] = stimSpike ? 1 : 0;
+        glbSpkStim[0] = 0;
+        SimulationTest::StepGeNN();
+    }
+};
+
+TEST_P(SimTest, InputArrivesAfterDelayOfSynapse)
+{
+    for(unsigned int s = 0; s < 20; s++) {
+        StepGeNN(s == 2);
+
+        // The input of each synapse is applied on exactly one time step
+        for(unsigned int i = 0; i < 4; i++) {
+            const float expected = (s == (2 + dSyn[i])) ? gSyn[i] : 0.0f;
+            ASSERT_FLOAT_EQ(xPost[i], expected) << "step " << s << " neuron " << i;
+        }
+    }
+}
+
+TEST_P(SimTest, InputsArrivingTogetherAccumulate)
+{
+    for(unsigned int s = 0; s < 12; s++) {
+        // Delays can be changed between time steps so both spikes arrive on time step 5
+        dSyn[0] = (s < 2) ? 4 : 2;
+        StepGeNN(s == 1 || s == 3);
+
+        ASSERT_FLOAT_EQ(xPost[0], (s == 5) ? 2.0f : 0.0f) << "step " << s;
+    }
+}
+
+TEST_P(SimTest, RingBufferWrapsAround)
+{
+    // Delays of the maximum of 7 time steps are delivered over many passes through the 8 slots
+    dSyn[3] = 7;
+    unsigned int numArrivals = 0;
+    for(unsigned int s = 0; s < 40; s++) {
+        StepGeNN((s % 3) == 0);
+
+        ASSERT_FLOAT_EQ(xPost[3], (s >= 7 && ((s - 7) % 3) == 0) ? 4.0f : 0.0f) << "step " << s;
+        numArrivals += (xPost[3] != 0.0f) ? 1 : 0;
+    }
+    EXPECT_EQ(numArrivals, 11u);
+}
+
+// Dendritic delays are only implemented in the CPU simulation code
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                ::testing::Values(false));
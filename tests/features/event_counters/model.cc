@@ -0,0 +1,50 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[2] = { // two neuron variables
+    0.0, // 0 - the input
+    0.0  // 1 - individual shift
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[1]= {
+    1.0 // the weight
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("event_counters");
+
+    neuronModel n;
+    n.varNames = {"x", "shift"};
+    n.varTypes = {"scalar", "scalar"};
+    n.simCode= "$(x)= $(Isyn);\n";
+    n.thresholdConditionCode= "$(x) > 0.5";
+
+    const int DUMMYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    // Static synapse parameters
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);    // 0 - Wij (nA)
+
+    model.addNeuronPopulation("Pre", 10, SPIKESOURCE, NULL, NULL);
+    model.addNeuronPopulation("Post", 4, DUMMYNEURON, NULL, neuron_ini);
+
+
+    model.addSynapsePopulation("Syn", NSYNAPSE, DENSE, GLOBALG, NO_DELAY, IZHIKEVICH_PS, "Pre", "Post",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+
+    model.setPrecision(GENN_FLOAT);
+    model.setEventCounting(true);
+    model.finalize();
+}
@@ -0,0 +1,61 @@
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        resetEventCounters();
+    }
+};
+
+TEST_P(SimTest, CountsEvents)
+{
+    // Drive presynaptic population with an increasing number of spikes on every other step
+    unsigned long long numPreSpikes = 0;
+    unsigned long long numActiveSteps = 0;
+    const unsigned int numSteps = (unsigned int)(10.0f / DT);
+    for(unsigned int i = 0; i < numSteps; i++)
+    {
+        const unsigned int numActive = (i % 2) ? (1 + (i % 10)) : 0;
+        glbSpkCntPre[0] = numActive;
+        for(unsigned int s = 0; s < numActive; s++)
+        {
+            glbSpkPre[s] = s;
+        }
+        numPreSpikes += numActive;
+        numActiveSteps += (numActive > 0) ? 1 : 0;
+
+        StepGeNN();
+    }
+
+    // Every presynaptic spike should update all 4 postsynaptic targets
+    EXPECT_EQ(synapseCountersSyn.preSpikes, numPreSpikes);
+    EXPECT_EQ(synapseCountersSyn.synapseUpdates, numPreSpikes * 4);
+    EXPECT_EQ(getTotalSynapseUpdates(), numPreSpikes * 4);
+    EXPECT_EQ(synapseCountersSyn.postLearnUpdates, 0ULL);
+    EXPECT_EQ(synapseCountersSyn.synDynUpdates, 0ULL);
+
+    // Every postsynaptic neuron should spike whenever it receives input
+    EXPECT_EQ(neuronCountersPost.spikes, numActiveSteps * 4);
+    EXPECT_EQ(neuronCountersPre.spikes, 0ULL);
+}
+
+// Event counters only instrument the CPU simulation code
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                ::testing::Values(false));
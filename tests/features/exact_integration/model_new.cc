@@ -0,0 +1,50 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Integrator
+//----------------------------------------------------------------------------
+class Integrator : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Integrator, 0, 1);
+
+    SET_SIM_CODE("$(q) += $(Isyn) * DT;\n");
+
+    SET_VARS({{"q", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Integrator);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    // **NOTE** exact integration is accurate at time steps far larger than Euler integration would allow
+    model.setDT(1.0);
+    model.setName("exact_integration_new");
+
+    NeuronModels::LIF::ParamValues lifParams(
+        1.0,    // 0 - C: membrane capacitance [nF]
+        20.0,   // 1 - TauM: membrane time constant [ms]
+        -70.0,  // 2 - Vrest: resting membrane potential [mV]
+        -70.0,  // 3 - Vreset: reset potential [mV]
+        -50.0,  // 4 - Vthresh: spiking threshold [mV]
+        1.5,    // 5 - Ioffset: offset current [nA]
+        2.0);   // 6 - TauRefrac: refractory period [ms]
+
+    PostsynapticModels::ExpCurr::ParamValues expCurrParams(
+        5.0);   // 0 - tau: decay time constant [ms]
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Stim", 1, {}, {});
+    model.addNeuronPopulation<NeuronModels::LIF>("LIF", 1, lifParams, NeuronModels::LIF::VarValues(-70.0, 0));
+    model.addNeuronPopulation<Integrator>("Integrator", 1, {}, Integrator::VarValues(0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::ExpCurr>(
+        "StimIntegrator", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "Stim", "Integrator",
+        {}, WeightUpdateModels::StaticPulse::VarValues(2.0),
+        expCurrParams, {});
+
+    model.setPrecision(GENN_DOUBLE);
+    model.finalize();
+}
@@ -0,0 +1,95 @@
+// Standard C++ includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Every simulation starts from the first time step
+        iT = 0;
+        t = 0.0;
+    }
+};
+
+TEST_P(SimTest, LIFMatchesExactSolution)
+{
+    // With constant input, V relaxes exponentially towards vInf = Vrest + (Ioffset * TauM / C)
+    const double vInf = -70.0 + (1.5 * 20.0 / 1.0);
+    unsigned int numUpdates = 0;
+    unsigned int refracSteps = 0;
+    unsigned int numSpikes = 0;
+    for(unsigned int s = 0; s < 100; s++) {
+        StepGeNN();
+
+        double v;
+        bool spike = false;
+        if(refracSteps > 0) {
+            refracSteps--;
+            v = -70.0;
+        }
+        else {
+            numUpdates++;
+            v = vInf + ((-70.0 - vInf) * std::exp(-(double)numUpdates * DT / 20.0));
+            if(v >= -50.0) {
+                spike = true;
+                v = -70.0;
+                numUpdates = 0;
+                refracSteps = 2;
+            }
+        }
+
+        ASSERT_NEAR(VLIF[0], v, 1e-9) << "step " << s;
+        ASSERT_EQ(glbSpkCntLIF[0], spike ? 1u : 0u) << "step " << s;
+        if(spike) {
+            // Threshold is crossed 20 * ln(3) ~= 21.97ms after each reset and the refractory period is two steps
+            ASSERT_EQ(s, 21 + (numSpikes * 24));
+            numSpikes++;
+        }
+    }
+    EXPECT_EQ(numSpikes, 4u);
+}
+
+TEST_P(SimTest, ExpCurrDeliversChargeOfInput)
+{
+    glbSpkCntStim[0] = 1;
+    glbSpkStim[0] = 0;
+#ifndef CPU_ONLY
+    if(GetParam()) {
+        pushStimSpikesToDevice();
+    }
+#endif  // CPU_ONLY
+
+    // The charge delivered by the input approaches weight * tau however large DT is
+    for(unsigned int s = 0; s < 50; s++) {
+        StepGeNN();
+
+        ASSERT_NEAR(qIntegrator[0], 2.0 * 5.0 * (1.0 - std::exp(-(double)(s + 1) * DT / 5.0)), 1e-9) << "step " << s;
+    }
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
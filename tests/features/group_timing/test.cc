@@ -0,0 +1,73 @@
+// Standard includes
+#include <cstring>
+#include <numeric>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        resetGroupTiming();
+    }
+};
+
+TEST_P(SimTest, CountsEveryUpdate)
+{
+    const unsigned int numSteps = (unsigned int)(10.0f / DT);
+    for(unsigned int i = 0; i < numSteps; i++)
+    {
+        glbSpkCntPre[0] = 1;
+        glbSpkPre[0] = i % 10;
+        StepGeNN();
+    }
+
+    // Every group should have been timed once per step
+    ASSERT_EQ(numGroupTimingStats, 3u);
+    for(unsigned int i = 0; i < numGroupTimingStats; i++)
+    {
+        const GroupTimingStats *s = groupTimingTable[i];
+        EXPECT_EQ(s->count, numSteps);
+        EXPECT_GE(s->totalSeconds, 0.0);
+        EXPECT_EQ(std::accumulate(&s->histogram[0], &s->histogram[GroupTimingStats::numBuckets], 0ULL), numSteps);
+    }
+    EXPECT_STREQ(synapseTimingSyn.name, "Syn");
+    EXPECT_STREQ(synapseTimingSyn.phase, "synapse");
+
+    // Check JSON dump contains one entry per group
+    dumpGroupTiming("group_timing.json");
+    FILE *f = fopen("group_timing.json", "r");
+    ASSERT_TRUE(f != NULL);
+    char line[1024];
+    unsigned int numEntries = 0;
+    while(fgets(line, sizeof(line), f) != NULL)
+    {
+        if(strstr(line, "\"group\"") != NULL)
+        {
+            numEntries++;
+        }
+    }
+    fclose(f);
+    remove("group_timing.json");
+    EXPECT_EQ(numEntries, numGroupTimingStats);
+}
+
+// Group timing only instruments the CPU simulation code
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                ::testing::Values(false));
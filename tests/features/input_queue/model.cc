@@ -0,0 +1,46 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[2] = { // two neuron variables
+    0.0, // 0 - the output
+    0.0  // 1 - the streamed input
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[1]= {
+    1.0 // the weight
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("input_queue");
+
+    neuronModel n;
+    n.varNames = {"x", "inp"};
+    n.varTypes = {"scalar", "scalar"};
+    n.simCode= "$(x)= $(Isyn) + $(inp);\n";
+
+    const int DUMMYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    NeuronGroup *pre = model.addNeuronPopulation("Pre", 10, SPIKESOURCE, NULL, NULL);
+    NeuronGroup *post = model.addNeuronPopulation("Post", 4, DUMMYNEURON, NULL, neuron_ini);
+    pre->setInputQueueCapacity(8);
+    post->setInputQueueCapacity(8);
+
+    model.addSynapsePopulation("Syn", NSYNAPSE, DENSE, GLOBALG, NO_DELAY, IZHIKEVICH_PS, "Pre", "Post",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,41 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE("$(x)= $(Isyn) + $(inp);\n");
+
+    SET_VARS({{"x", "scalar"}, {"inp", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("input_queue_new");
+
+    // Static synapse parameters
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);    // 0 - Wij (nA)
+
+    NeuronGroup *pre = model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 10, {}, {});
+    NeuronGroup *post = model.addNeuronPopulation<Neuron>("Post", 4, {}, Neuron::VarValues(0.0, 0.0));
+    pre->setInputQueueCapacity(8);
+    post->setInputQueueCapacity(8);
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,113 @@
+// Standard includes
+#include <thread>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+    }
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    bool Simulate()
+    {
+        const unsigned int numSteps = (unsigned int)(10.0f / DT);
+
+        // Producer thread streams spikes into Pre and input values into Post,
+        // spinning whenever the (deliberately small) queues are full
+        std::thread producer(
+            [numSteps]()
+            {
+                unsigned int spikes[10];
+                float values[4];
+                for(unsigned int i = 0; i < numSteps; i++)
+                {
+                    const unsigned int num_active_pre = i / 10;
+                    for(unsigned int s = 0; s < num_active_pre; s++)
+                    {
+                        spikes[s] = s;
+                    }
+                    while(!inputQueuePre.pushSpikes(i, spikes, num_active_pre))
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    std::fill(&values[0], &values[4], (float)i);
+                    while(!inputQueuePost.pushValues(i, inputTargetinpPost, values))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+        bool correct = true;
+        for (unsigned int i = 0; i < numSteps; i++)
+        {
+            // Wait until producer has provided the input for this timestep
+            while((inputQueuePre.front() == NULL) || (inputQueuePost.front() == NULL))
+            {
+                std::this_thread::yield();
+            }
+
+#ifndef CPU_ONLY
+            if(GetParam())
+            {
+                applyInputQueuePre();
+                applyInputQueuePost();
+                pushPreCurrentSpikesToDevice();
+                pushPostStateToDevice();
+            }
+#endif  // CPU_ONLY
+
+            // Step GeNN
+            StepGeNN();
+
+            // Loop through output neurons
+            const unsigned int num_active_pre = i / 10;
+            for(unsigned int j = 0; j < 4; j++)
+            {
+                // If activation of postsynaptic neuron doesn't reflect both inputs, fail
+                if(fabs(xPost[j] - (float)(num_active_pre + i)) >= 1E-5)
+                {
+                    correct = false;
+                }
+            }
+        }
+
+        producer.join();
+        return correct;
+    }
+};
+
+TEST_P(SimTest, CorrectStreaming)
+{
+    EXPECT_TRUE(Simulate());
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
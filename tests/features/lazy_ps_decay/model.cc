@@ -0,0 +1,57 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[2] = {
+    0.0, // 0 - membrane potential
+    0.0  // 1 - integrated input
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[1]= {
+    0.0 // 0 - the weight
+};
+
+double postExp_p[2]= {
+    5.0, // 0 - tau_S: decay time constant for S [ms]
+    1.0  // 1 - Erev: Reversal potential
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(1.0);
+    model.setName("lazy_ps_decay");
+
+    neuronModel n;
+    n.varNames = {"V", "q"};
+    n.varTypes = {"scalar", "scalar"};
+    n.simCode= "$(q) += $(Isyn) * DT;\n";
+    n.thresholdConditionCode = "$(q) >= 1000.0";
+
+    const int INTEGRATORNEURON= nModels.size();
+    nModels.push_back(n);
+
+    model.addNeuronPopulation("Stim", 1, SPIKESOURCE, NULL, NULL);
+    model.addNeuronPopulation("Eager", 2, INTEGRATORNEURON, NULL, neuron_ini);
+    model.addNeuronPopulation("Lazy", 2, INTEGRATORNEURON, NULL, neuron_ini);
+
+    model.addSynapsePopulation("StimEager", NSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, EXPDECAY, "Stim", "Eager",
+                               synapses_ini, NULL,
+                               NULL, postExp_p);
+    SynapseGroup *lazy = model.addSynapsePopulation("StimLazy", NSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, EXPDECAY, "Stim", "Lazy",
+                                                    synapses_ini, NULL,
+                                                    NULL, postExp_p);
+
+    // The input to Lazy is decayed by scaling the whole group rather than every neuron
+    lazy->setPSLazyDecayEnabled(true);
+
+    model.setPrecision(GENN_DOUBLE);
+    model.finalize();
+}
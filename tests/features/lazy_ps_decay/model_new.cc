@@ -0,0 +1,50 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE("$(q) += $(Isyn) * DT;\n");
+
+    SET_THRESHOLD_CONDITION_CODE("$(q) >= 1000.0");
+
+    SET_VARS({{"V", "scalar"}, {"q", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(1.0);
+    model.setName("lazy_ps_decay_new");
+
+    PostsynapticModels::ExpCond::ParamValues expCondParams(
+        5.0,    // 0 - tau_S: decay time constant for S [ms]
+        1.0);   // 1 - Erev: Reversal potential
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Stim", 1, {}, {});
+    model.addNeuronPopulation<Neuron>("Eager", 2, {}, Neuron::VarValues(0.0, 0.0));
+    model.addNeuronPopulation<Neuron>("Lazy", 2, {}, Neuron::VarValues(0.0, 0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::ExpCond>(
+        "StimEager", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Eager",
+        {}, WeightUpdateModels::StaticPulse::VarValues(0.0),
+        expCondParams, {});
+    SynapseGroup *lazy = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::ExpCond>(
+        "StimLazy", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Lazy",
+        {}, WeightUpdateModels::StaticPulse::VarValues(0.0),
+        expCondParams, {});
+
+    // The input to Lazy is decayed by scaling the whole group rather than every neuron
+    lazy->setPSLazyDecayEnabled(true);
+
+    model.setPrecision(GENN_DOUBLE);
+    model.finalize();
+}
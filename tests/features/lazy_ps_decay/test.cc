@@ -0,0 +1,114 @@
+// Standard C++ includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        gStimEager[0] = 1.0;
+        gStimEager[1] = 0.5;
+        gStimLazy[0] = 1.0;
+        gStimLazy[1] = 0.5;
+    }
+
+protected:
+    //----------------------------------------------------------------------------
+    // Protected methods
+    //----------------------------------------------------------------------------
+    void StepGeNN(bool stimSpike)
+    {
+        glbSpkCntStim[0] = stimSpike ? 1 : 0;
+        glbSpkStim[0] = 0;
+#ifndef CPU_ONLY
+        if(GetParam()) {
+            pushStimSpikesToDevice();
+        }
+#endif  // CPU_ONLY
+        SimulationTest::StepGeNN();
+    }
+};
+
+TEST_P(SimTest, LazyDecayMatchesEagerDecay)
+{
+    for(unsigned int s = 0; s < 300; s++) {
+        StepGeNN(s == 3 || s == 4 || s == 20 || s == 50 || s == 150);
+
+        // The charge delivered so far is the same whichever way the input is decayed
+        for(unsigned int i = 0; i < 2; i++) {
+            ASSERT_NEAR(qLazy[i], qEager[i], 1e-9 * std::fabs(qEager[i])) << "step " << s;
+        }
+    }
+    EXPECT_GT(qLazy[0], 0.0);
+}
+
+TEST_P(SimTest, InputIsNotRewrittenByNeuronUpdate)
+{
+    // **NOTE** the GPU kernels decay their input on every time step
+    if (GetParam()) {
+        return;
+    }
+
+    StepGeNN(false);
+    StepGeNN(true);
+    const double stored[2] = {inSynStimLazy[0], inSynStimLazy[1]};
+    for(unsigned int s = 0; s < 10; s++) {
+        StepGeNN(false);
+
+        // Only the scale shared by the group is decayed and it gives the same input as eager decay
+        for(unsigned int i = 0; i < 2; i++) {
+            ASSERT_EQ(inSynStimLazy[i], stored[i]) << "step " << s;
+            ASSERT_NEAR(inSynStimLazy[i] * inSynScaleStimLazy, inSynStimEager[i], 1e-12) << "step " << s;
+        }
+    }
+    EXPECT_NEAR(inSynStimLazy[0] * inSynScaleStimLazy, std::exp(-11.0 / 5.0), 1e-12);
+}
+
+TEST_P(SimTest, ScaleIsRenormalised)
+{
+    if (GetParam()) {
+        return;
+    }
+
+    bool renormalised = false;
+    double lastScale = inSynScaleStimLazy;
+    for(unsigned int s = 0; s < 200; s++) {
+        StepGeNN(s == 3);
+
+        // The scale never becomes small enough for the stored input to lose range
+        ASSERT_GE(inSynScaleStimLazy, 1e-10) << "step " << s;
+        renormalised |= (inSynScaleStimLazy > lastScale);
+        lastScale = inSynScaleStimLazy;
+
+        for(unsigned int i = 0; i < 2; i++) {
+            ASSERT_NEAR(inSynStimLazy[i] * inSynScaleStimLazy, inSynStimEager[i], 1e-9 * inSynStimEager[i]) << "step " << s;
+        }
+    }
+    EXPECT_TRUE(renormalised);
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
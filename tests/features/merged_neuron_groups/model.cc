@@ -0,0 +1,77 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[1] = {
+    0.0 // 0 - the input
+};
+
+double neuronA_p[1] = {
+    0.5 // 0 - constant drive
+};
+
+double neuronB_p[1] = {
+    2.0 // 0 - constant drive
+};
+
+double neuronC_p[1] = {
+    0.5 // 0 - constant drive
+};
+
+
+// Synapses
+//==================================================
+
+double synapsesA_ini[1]= {
+    0.5 // the weight
+};
+
+double synapsesB_ini[1]= {
+    0.5 // the weight
+};
+
+double synapsesC_ini[1]= {
+    1.5 // the weight
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("merged_neuron_groups");
+
+    neuronModel n;
+    n.varNames = {"x"};
+    n.varTypes = {"scalar"};
+    n.pNames = {"a"};
+    n.simCode= "$(x) += $(a) + $(Isyn);\n";
+    n.thresholdConditionCode= "$(x) >= 10.0";
+    n.resetCode= "$(x) = 0.0;\n";
+
+    const int DUMMYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    // Groups which only differ in their parameters and sizes
+    model.addNeuronPopulation("StimA", 1, SPIKESOURCE, NULL, NULL);
+    model.addNeuronPopulation("StimB", 1, SPIKESOURCE, NULL, NULL);
+    model.addNeuronPopulation("StimC", 1, SPIKESOURCE, NULL, NULL);
+    model.addNeuronPopulation("PopA", 10, DUMMYNEURON, neuronA_p, neuron_ini);
+    model.addNeuronPopulation("PopB", 20, DUMMYNEURON, neuronB_p, neuron_ini);
+    model.addNeuronPopulation("PopC", 5, DUMMYNEURON, neuronC_p, neuron_ini);
+
+    model.addSynapsePopulation("SynA", NSYNAPSE, DENSE, GLOBALG, NO_DELAY, IZHIKEVICH_PS, "StimA", "PopA",
+                               synapsesA_ini, NULL,
+                               NULL, NULL);
+    model.addSynapsePopulation("SynB", NSYNAPSE, DENSE, GLOBALG, NO_DELAY, IZHIKEVICH_PS, "StimB", "PopB",
+                               synapsesB_ini, NULL,
+                               NULL, NULL);
+    model.addSynapsePopulation("SynC", NSYNAPSE, DENSE, GLOBALG, NO_DELAY, IZHIKEVICH_PS, "StimC", "PopC",
+                               synapsesC_ini, NULL,
+                               NULL, NULL);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
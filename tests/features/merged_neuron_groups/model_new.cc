@@ -0,0 +1,57 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 1, 1);
+
+    SET_SIM_CODE("$(x) += $(twoA) - $(a) + $(Isyn);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("$(x) >= 10.0");
+
+    SET_RESET_CODE("$(x) = 0.0;\n");
+
+    SET_PARAM_NAMES({"a"});
+
+    SET_DERIVED_PARAMS({{"twoA", [](const vector<double> &pars, double){ return 2.0 * pars[0]; }}});
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("merged_neuron_groups_new");
+
+    // Groups which only differ in their parameters and sizes
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("StimA", 1, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("StimB", 1, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("StimC", 1, {}, {});
+    model.addNeuronPopulation<Neuron>("PopA", 10, Neuron::ParamValues(0.5), Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PopB", 20, Neuron::ParamValues(2.0), Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PopC", 5, Neuron::ParamValues(0.5), Neuron::VarValues(0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynA", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "StimA", "PopA",
+        {}, WeightUpdateModels::StaticPulse::VarValues(0.5),
+        {}, {});
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynB", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "StimB", "PopB",
+        {}, WeightUpdateModels::StaticPulse::VarValues(0.5),
+        {}, {});
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynC", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "StimC", "PopC",
+        {}, WeightUpdateModels::StaticPulse::VarValues(1.5),
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,85 @@
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+    }
+};
+
+//----------------------------------------------------------------------------
+// GroupState
+//----------------------------------------------------------------------------
+// Expected state of one of the merged groups
+struct GroupState
+{
+    unsigned int numNeurons;
+    float increment;
+    float x;
+    bool spiked;
+
+    void step()
+    {
+        x += increment;
+        spiked = (x >= 10.0f);
+        if(spiked) {
+            x = 0.0f;
+        }
+    }
+};
+
+TEST_P(SimTest, UpdatesEachGroupWithItsOwnParameters)
+{
+    // Each step every group is driven by its constant parameter and the spike arriving through its own synapse group
+    GroupState popA{10, 0.5f + 0.5f, 0.0f, false};
+    GroupState popB{20, 2.0f + 0.5f, 0.0f, false};
+    GroupState popC{5, 0.5f + 1.5f, 0.0f, false};
+    for(unsigned int i = 0; i < 25; i++)
+    {
+        glbSpkCntStimA[0] = 1;
+        glbSpkStimA[0] = 0;
+        glbSpkCntStimB[0] = 1;
+        glbSpkStimB[0] = 0;
+        glbSpkCntStimC[0] = 1;
+        glbSpkStimC[0] = 0;
+
+        StepGeNN();
+
+        popA.step();
+        popB.step();
+        popC.step();
+
+        for(unsigned int n = 0; n < popA.numNeurons; n++) {
+            ASSERT_EQ(xPopA[n], popA.x);
+        }
+        for(unsigned int n = 0; n < popB.numNeurons; n++) {
+            ASSERT_EQ(xPopB[n], popB.x);
+        }
+        for(unsigned int n = 0; n < popC.numNeurons; n++) {
+            ASSERT_EQ(xPopC[n], popC.x);
+        }
+        ASSERT_EQ(glbSpkCntPopA[0], popA.spiked ? popA.numNeurons : 0);
+        ASSERT_EQ(glbSpkCntPopB[0], popB.spiked ? popB.numNeurons : 0);
+        ASSERT_EQ(glbSpkCntPopC[0], popC.spiked ? popC.numNeurons : 0);
+    }
+}
+
+// Neuron groups are only merged in the CPU simulation code
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                ::testing::Values(false));
@@ -0,0 +1,61 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE("$(x) += $(shift) + $(Isyn);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("$(x) >= 10.0");
+
+    SET_RESET_CODE("$(x) = 0.0;\n");
+
+    SET_VARS({{"x", "scalar"}, {"shift", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SIM_CODE(
+        "$(addtoinSyn) = $(g);\n"
+        "$(updatelinsyn);\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("multi_step_new");
+    model.setTiming(true);
+
+    NeuronGroup *pre = model.addNeuronPopulation<Neuron>("Pre", 8, {}, Neuron::VarValues(0.0, 0.0));
+    NeuronGroup *post = model.addNeuronPopulation<Neuron>("Post", 8, {}, Neuron::VarValues(0.0, 0.0));
+
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::DENSE_INDIVIDUALG, 3, "Pre", "Post",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {});
+
+    pre->setSpikeRecordingEnabled(true);
+    post->setSpikeRecordingEnabled(true);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
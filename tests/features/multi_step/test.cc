@@ -0,0 +1,148 @@
+// Standard C++ includes
+#include <algorithm>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Every simulation starts from the first time step
+        iT = 0;
+        t = 0.0;
+
+        // Each presynaptic neuron spikes at a different rate and drives one postsynaptic neuron
+        for(unsigned int i = 0; i < 8; i++) {
+            shiftPre[i] = (float)(i + 1);
+            for(unsigned int j = 0; j < 8; j++) {
+                gSyn[(i * 8) + j] = (i == j) ? 4.0f : 0.0f;
+            }
+        }
+    }
+
+protected:
+    //----------------------------------------------------------------------------
+    // Protected methods
+    //----------------------------------------------------------------------------
+    void Restart()
+    {
+        initialize();
+        Init();
+#ifndef CPU_ONLY
+        if(GetParam()) {
+            copyStateToDevice();
+        }
+#endif  // CPU_ONLY
+    }
+
+    void StepGeNN(unsigned int numSteps)
+    {
+#ifndef CPU_ONLY
+        if(GetParam()) {
+            stepTimeGPU(numSteps);
+            copyStateFromDevice();
+        }
+        else
+#endif  // CPU_ONLY
+        {
+            stepTimeCPU(numSteps);
+        }
+    }
+};
+
+TEST_P(SimTest, MultiStepMatchesSingleSteps)
+{
+    // Simulate one step at a time, keeping the (sorted) spikes of every step
+    std::vector<std::vector<unsigned int>> preSpikes(50), postSpikes(50);
+    for(unsigned int s = 0; s < 50; s++) {
+        SimulationTest::StepGeNN();
+#ifndef CPU_ONLY
+        if(GetParam()) {
+            copyCurrentSpikesFromDevice();
+        }
+#endif  // CPU_ONLY
+        preSpikes[s].assign(spike_Pre, spike_Pre + spikeCount_Pre);
+        postSpikes[s].assign(spike_Post, spike_Post + spikeCount_Post);
+        std::sort(preSpikes[s].begin(), preSpikes[s].end());
+        std::sort(postSpikes[s].begin(), postSpikes[s].end());
+    }
+    const std::vector<float> preX(xPre, xPre + 8);
+    const std::vector<float> postX(xPost, xPost + 8);
+
+    // Simulate the same steps again in one call
+    Restart();
+    allocateSpikeRecording(50);
+    const double neuronTime = neuron_tme;
+    StepGeNN(50);
+
+    EXPECT_EQ(iT, 50ull);
+    EXPECT_GT(neuron_tme, neuronTime);
+
+    unsigned int numPostSpikes = 0;
+    for(unsigned int s = 0; s < 50; s++) {
+        std::vector<unsigned int> pre(&recordSpkPre[s * 8], &recordSpkPre[s * 8] + recordSpkCntPre[s]);
+        std::vector<unsigned int> post(&recordSpkPost[s * 8], &recordSpkPost[s * 8] + recordSpkCntPost[s]);
+        std::sort(pre.begin(), pre.end());
+        std::sort(post.begin(), post.end());
+        ASSERT_EQ(pre, preSpikes[s]) << "step " << s;
+        ASSERT_EQ(post, postSpikes[s]) << "step " << s;
+        numPostSpikes += recordSpkCntPost[s];
+    }
+
+    // **NOTE** postsynaptic neurons are only driven by delayed spikes so this checks the delay queue is advanced
+    EXPECT_GT(numPostSpikes, 0u);
+
+    for(unsigned int i = 0; i < 8; i++) {
+        ASSERT_FLOAT_EQ(xPre[i], preX[i]);
+        ASSERT_FLOAT_EQ(xPost[i], postX[i]);
+    }
+}
+
+TEST_P(SimTest, CallsContinueFromEachOther)
+{
+    // Ten single steps followed by two calls of twenty steps reach the same state as fifty single steps
+    allocateSpikeRecording(20);
+    for(unsigned int s = 0; s < 10; s++) {
+        SimulationTest::StepGeNN();
+    }
+    StepGeNN(20);
+    StepGeNN(20);
+    EXPECT_EQ(iT, 50ull);
+    const std::vector<float> preX(xPre, xPre + 8);
+    const std::vector<float> postX(xPost, xPost + 8);
+
+    Restart();
+    for(unsigned int s = 0; s < 50; s++) {
+        SimulationTest::StepGeNN();
+    }
+    for(unsigned int i = 0; i < 8; i++) {
+        ASSERT_FLOAT_EQ(xPre[i], preX[i]);
+        ASSERT_FLOAT_EQ(xPost[i], postX[i]);
+    }
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
@@ -0,0 +1,73 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[1] = {
+    0.0 // 0 - the input
+};
+
+double neuron_p[4][1] = {
+    {1.0}, // 0 - constant drive of Pop0
+    {2.0}, // 0 - constant drive of Pop1
+    {3.0}, // 0 - constant drive of Pop2
+    {4.0}  // 0 - constant drive of Pop3
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[1]= {
+    0.5 // the weight
+};
+
+double synapsesOther_ini[1]= {
+    0.25 // the weight
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+    GENN_PREFERENCES::codeGenerationThreads = 4;
+
+    model.setDT(0.1);
+    model.setName("parallel_generation");
+
+    neuronModel n;
+    n.varNames = {"x"};
+    n.varTypes = {"scalar"};
+    n.pNames = {"shift"};
+    n.simCode= "$(x) += $(shift) + $(Isyn);\n";
+
+    const int DUMMYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    neuronModel o;
+    o.varNames = {"x"};
+    o.varTypes = {"scalar"};
+    o.simCode= "$(x) -= $(Isyn);\n";
+
+    const int OTHERNEURON= nModels.size();
+    nModels.push_back(o);
+
+    model.addNeuronPopulation("Stim", 1, SPIKESOURCE, NULL, NULL);
+
+    // Groups which only differ in their parameter share one merged update
+    for(unsigned int i = 0; i < 4; i++) {
+        const std::string index = std::to_string(i);
+        model.addNeuronPopulation("Pop" + index, 10, DUMMYNEURON, neuron_p[i], neuron_ini);
+        model.addSynapsePopulation("Syn" + index, NSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "Pop" + index,
+                                   synapses_ini, NULL,
+                                   NULL, NULL);
+    }
+
+    model.addNeuronPopulation("Other", 10, OTHERNEURON, NULL, neuron_ini);
+    model.addSynapsePopulation("SynOther", NSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "Other",
+                               synapsesOther_ini, NULL,
+                               NULL, NULL);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,63 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 1, 1);
+
+    SET_SIM_CODE("$(x) += $(shift) + $(Isyn);\n");
+
+    SET_PARAM_NAMES({"shift"});
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// OtherNeuron
+//----------------------------------------------------------------------------
+class OtherNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(OtherNeuron, 0, 1);
+
+    SET_SIM_CODE("$(x) -= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(OtherNeuron);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+    GENN_PREFERENCES::codeGenerationThreads = 4;
+
+    model.setDT(0.1);
+    model.setName("parallel_generation_new");
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Stim", 1, {}, {});
+
+    // Groups which only differ in their parameter share one merged update
+    for(unsigned int i = 0; i < 4; i++) {
+        const std::string index = std::to_string(i);
+        model.addNeuronPopulation<Neuron>("Pop" + index, 10, Neuron::ParamValues((double)(i + 1)), Neuron::VarValues(0.0));
+        model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+            "Syn" + index, SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Pop" + index,
+            {}, WeightUpdateModels::StaticPulse::VarValues(0.5),
+            {}, {});
+    }
+
+    model.addNeuronPopulation<OtherNeuron>("Other", 10, {}, OtherNeuron::VarValues(0.0));
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynOther", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Other",
+        {}, WeightUpdateModels::StaticPulse::VarValues(0.25),
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
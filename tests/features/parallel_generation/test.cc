@@ -0,0 +1,57 @@
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+    }
+};
+
+TEST_P(SimTest, UpdatesGroupsGeneratedOnSeparateThreads)
+{
+    float *const popX[4] = {xPop0, xPop1, xPop2, xPop3};
+
+    // Each step every neuron is driven by its group's shift and the spike arriving through its synapse group
+    for(unsigned int i = 0; i < 20; i++)
+    {
+        glbSpkCntStim[0] = 1;
+        glbSpkStim[0] = 0;
+
+        StepGeNN();
+
+        const float steps = (float)(i + 1);
+        for(unsigned int g = 0; g < 4; g++) {
+            for(unsigned int n = 0; n < 10; n++) {
+                ASSERT_FLOAT_EQ(popX[g][n], steps * ((float)(g + 1) + 0.5f));
+            }
+        }
+        for(unsigned int n = 0; n < 10; n++) {
+            ASSERT_FLOAT_EQ(xOther[n], -steps * 0.25f);
+        }
+    }
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
@@ -0,0 +1,65 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[1] = {
+    0.0 // 0 - the input
+};
+
+double neuronA_p[1] = {
+    1.0 // 0 - constant drive
+};
+
+double neuronB_p[1] = {
+    2.0 // 0 - constant drive
+};
+
+double neuronC_p[1] = {
+    3.0 // 0 - constant drive
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[1]= {
+    0.5 // the weight
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("profile_guided");
+
+    // Profile of an earlier build in which PopA took most of the neuron update time
+    // and each presynaptic neuron of Syn spiked many times per step
+    model.setProfile("profile.txt");
+    model.setGroupTiming(true);
+    model.setEventCounting(true);
+
+    neuronModel n;
+    n.varNames = {"x"};
+    n.varTypes = {"scalar"};
+    n.pNames = {"a"};
+    n.simCode= "$(x) += $(a) + $(Isyn);\n";
+
+    const int DUMMYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    // Groups which only differ in their parameters
+    model.addNeuronPopulation("Stim", 20, SPIKESOURCE, NULL, NULL);
+    model.addNeuronPopulation("PopA", 10, DUMMYNEURON, neuronA_p, neuron_ini);
+    model.addNeuronPopulation("PopB", 10, DUMMYNEURON, neuronB_p, neuron_ini);
+    model.addNeuronPopulation("PopC", 10, DUMMYNEURON, neuronC_p, neuron_ini);
+
+    model.addSynapsePopulation("Syn", NSYNAPSE, SPARSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "PopA",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
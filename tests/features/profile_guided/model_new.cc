@@ -0,0 +1,46 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 1, 1);
+
+    SET_SIM_CODE("$(x) += $(a) + $(Isyn);\n");
+
+    SET_PARAM_NAMES({"a"});
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("profile_guided_new");
+
+    // Profile of an earlier build in which PopA took most of the neuron update time
+    // and each presynaptic neuron of Syn spiked many times per step
+    model.setProfile("profile.txt");
+    model.setGroupTiming(true);
+    model.setEventCounting(true);
+
+    // Groups which only differ in their parameters
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Stim", 20, {}, {});
+    model.addNeuronPopulation<Neuron>("PopA", 10, Neuron::ParamValues(1.0), Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PopB", 10, Neuron::ParamValues(2.0), Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PopC", 10, Neuron::ParamValues(3.0), Neuron::VarValues(0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Stim", "PopA",
+        {}, WeightUpdateModels::StaticPulse::VarValues(0.5),
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,136 @@
+// Standard C++ includes
+#include <fstream>
+#include <set>
+#include <string>
+
+// Standard C includes
+#include <cstdio>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Stim neurons i and i + 10 connect to PopA neuron i
+        allocateSyn(20);
+        for(unsigned int i = 0; i < 20; i++) {
+            CSyn.indInG[i] = i;
+            CSyn.ind[i] = i % 10;
+            gSyn[i] = 0.5f;
+        }
+        CSyn.indInG[20] = 20;
+#ifndef CPU_ONLY
+        initializeAllSparseArrays();
+#endif  // CPU_ONLY
+
+        resetGroupTiming();
+        resetEventCounters();
+    }
+};
+
+//----------------------------------------------------------------------------
+// Functions
+//----------------------------------------------------------------------------
+// Read the lines of a text file into a set
+std::set<std::string> readLines(const std::string &filename)
+{
+    std::ifstream is(filename.c_str());
+    std::set<std::string> lines;
+    std::string line;
+    while(std::getline(is, line)) {
+        lines.insert(line);
+    }
+    return lines;
+}
+
+TEST_P(SimTest, ReportsChoicesMadeFromProfile)
+{
+    const auto report = readLines(SIM_CODE_PATH "/profileReport.txt");
+
+    // 15 spikes per step can be processed by more threads than the 10 synapses of each row
+    EXPECT_EQ(report.count("synapse group Syn: 15 presynaptic spikes per step, up to 10 connections per presynaptic neuron - presynaptic span"), 1);
+
+#ifdef CPU_ONLY
+    // PopA takes too large a share of the update time to be merged with the other groups of the same model
+    EXPECT_EQ(report.count("neuron group PopA: 80% of the neuron update time - specialised CPU update"), 1);
+    EXPECT_EQ(report.count("neuron group PopB: 10% of the neuron update time - merged CPU update"), 1);
+    EXPECT_EQ(report.count("neuron group PopC: 10% of the neuron update time - merged CPU update"), 1);
+    EXPECT_EQ(report.count("neuron group Stim: 0% of the neuron update time - own CPU update"), 1);
+#endif  // CPU_ONLY
+}
+
+TEST_P(SimTest, WritesProfile)
+{
+    for(unsigned int i = 0; i < 10; i++) {
+        glbSpkCntStim[0] = 20;
+        for(unsigned int j = 0; j < 20; j++) {
+            glbSpkStim[j] = j;
+        }
+
+        StepGeNN();
+
+        // Each PopA neuron receives two spikes per step
+        const float steps = (float)(i + 1);
+        for(unsigned int n = 0; n < 10; n++) {
+            ASSERT_FLOAT_EQ(xPopA[n], steps * 2.0f);
+            ASSERT_FLOAT_EQ(xPopB[n], steps * 2.0f);
+            ASSERT_FLOAT_EQ(xPopC[n], steps * 3.0f);
+        }
+    }
+
+    // Timing and event counting are only done by the CPU updates
+    if(!GetParam()) {
+        dumpProfile("profile_out.txt");
+
+        std::ifstream is("profile_out.txt");
+        std::string line;
+        std::set<std::string> profiled;
+        while(std::getline(is, line)) {
+            if(line[0] == '#') {
+                continue;
+            }
+
+            char phase[32];
+            char group[32];
+            unsigned long long updates;
+            double seconds;
+            unsigned long long events;
+            ASSERT_EQ(sscanf(line.c_str(), "%31s %31s %llu %lf %llu", phase, group, &updates, &seconds, &events), 5);
+            EXPECT_EQ(updates, 10);
+            EXPECT_GE(seconds, 0.0);
+            if(std::string(phase) == "synapse") {
+                EXPECT_EQ(events, 200);
+            }
+            profiled.insert(std::string(phase) + " " + group);
+        }
+        remove("profile_out.txt");
+
+        EXPECT_EQ(profiled, std::set<std::string>({"neuron PopA", "neuron PopB", "neuron PopC", "neuron Stim", "synapse Syn"}));
+    }
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
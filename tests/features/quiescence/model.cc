@@ -0,0 +1,53 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[2] = {
+    0.0, // 0 - membrane potential
+    0.0  // 1 - number of updates
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[1]= {
+    0.0 // 0 - the weight
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(1.0);
+    model.setName("quiescence");
+
+    neuronModel n;
+    n.varNames = {"V", "updates"};
+    n.varTypes = {"scalar", "scalar"};
+    n.simCode= "$(V) += $(Isyn) - ($(V) * (DT / 10.0));\n$(updates) += 1.0;\n";
+    n.thresholdConditionCode = "$(V) >= 1000.0";
+    n.restConditionCode = "fabs($(V)) < 0.01";
+
+    const int LEAKYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    model.addNeuronPopulation("Stim", 1, SPIKESOURCE, NULL, NULL);
+    NeuronGroup *quiet = model.addNeuronPopulation("Quiet", 2, LEAKYNEURON, NULL, neuron_ini);
+    model.addNeuronPopulation("Ref", 2, LEAKYNEURON, NULL, neuron_ini);
+
+    model.addSynapsePopulation("StimQuiet", NSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "Quiet",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+    model.addSynapsePopulation("StimRef", NSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "Ref",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+
+    // Quiet is not updated while all of its neurons are at rest and receive no input
+    quiet->setQuiescenceSkippingEnabled(true);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,50 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE(
+        "$(V) += $(Isyn) - ($(V) * (DT / 10.0));\n"
+        "$(updates) += 1.0;\n");
+
+    SET_THRESHOLD_CONDITION_CODE("$(V) >= 1000.0");
+
+    SET_REST_CONDITION_CODE("fabs($(V)) < 0.01");
+
+    SET_VARS({{"V", "scalar"}, {"updates", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(1.0);
+    model.setName("quiescence_new");
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Stim", 1, {}, {});
+    NeuronGroup *quiet = model.addNeuronPopulation<Neuron>("Quiet", 2, {}, Neuron::VarValues(0.0, 0.0));
+    model.addNeuronPopulation<Neuron>("Ref", 2, {}, Neuron::VarValues(0.0, 0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "StimQuiet", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Quiet",
+        {}, WeightUpdateModels::StaticPulse::VarValues(0.0),
+        {}, {});
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "StimRef", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Ref",
+        {}, WeightUpdateModels::StaticPulse::VarValues(0.0),
+        {}, {});
+
+    // Quiet is not updated while all of its neurons are at rest and receive no input
+    quiet->setQuiescenceSkippingEnabled(true);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
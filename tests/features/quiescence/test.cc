@@ -0,0 +1,138 @@
+// Standard C++ includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Only the first neuron of each group receives input from Stim
+        gStimQuiet[0] = 1.0f;
+        gStimQuiet[1] = 0.0f;
+        gStimRef[0] = 1.0f;
+        gStimRef[1] = 0.0f;
+    }
+
+protected:
+    //----------------------------------------------------------------------------
+    // Protected methods
+    //----------------------------------------------------------------------------
+    void StepGeNN(bool stimSpike)
+    {
+        glbSpkCntStim[0] = stimSpike ? 1 : 0;
+        glbSpkStim[0] = 0;
+#ifndef CPU_ONLY
+        if(GetParam()) {
+            pushStimSpikesToDevice();
+        }
+#endif  // CPU_ONLY
+        SimulationTest::StepGeNN();
+    }
+
+    //! Are quiescent groups skipped by the backend being tested
+    bool IsSkipping() const
+    {
+        // **NOTE** the GPU kernels update every neuron group on every time step
+        return !GetParam();
+    }
+};
+
+TEST_P(SimTest, SkipsUpdatesAtRest)
+{
+    for(unsigned int s = 0; s < 20; s++) {
+        StepGeNN(false);
+    }
+
+    // Both groups start at rest so Quiet is only updated on the first time step
+    for(unsigned int i = 0; i < 2; i++) {
+        EXPECT_FLOAT_EQ(updatesRef[i], 20.0f);
+        EXPECT_FLOAT_EQ(updatesQuiet[i], IsSkipping() ? 1.0f : 20.0f);
+        EXPECT_FLOAT_EQ(VQuiet[i], 0.0f);
+    }
+    if (IsSkipping()) {
+        EXPECT_TRUE(quiescentQuiet);
+    }
+}
+
+TEST_P(SimTest, InputWakesGroupUntilRestIsReached)
+{
+    // Stimulate on step 5, after Quiet has become quiescent, then let the input decay
+    unsigned int expectedUpdates = 1;
+    bool rested = true;
+    for(unsigned int s = 0; s < 80; s++) {
+        StepGeNN(s == 5);
+
+        if (s == 5) {
+            rested = false;
+        }
+        if (!rested) {
+            // While Quiet is updated it follows Ref exactly
+            expectedUpdates++;
+            ASSERT_FLOAT_EQ(VQuiet[0], VRef[0]) << "step " << s;
+            rested = (std::fabs(VRef[0]) < 0.01f);
+        }
+    }
+
+    // The decay takes several tens of time steps to reach rest, after which Quiet stays within the rest condition of Ref
+    EXPECT_GT(expectedUpdates, 40u);
+    EXPECT_LT(expectedUpdates, 60u);
+    EXPECT_NEAR(VQuiet[0], VRef[0], 0.01);
+    EXPECT_FLOAT_EQ(VQuiet[1], 0.0f);
+    for(unsigned int i = 0; i < 2; i++) {
+        EXPECT_FLOAT_EQ(updatesRef[i], 80.0f);
+        EXPECT_FLOAT_EQ(updatesQuiet[i], IsSkipping() ? (float)expectedUpdates : 80.0f);
+    }
+    if (IsSkipping()) {
+        EXPECT_TRUE(quiescentQuiet);
+    }
+}
+
+TEST_P(SimTest, HostChangesWakeGroupWhenFlagIsCleared)
+{
+    for(unsigned int s = 0; s < 10; s++) {
+        StepGeNN(false);
+    }
+
+    // Move a neuron of each group away from rest from the host
+    VQuiet[1] = 1.0f;
+    VRef[1] = 1.0f;
+    quiescentQuiet = false;
+#ifndef CPU_ONLY
+    if(GetParam()) {
+        pushQuietStateToDevice();
+        pushRefStateToDevice();
+    }
+#endif  // CPU_ONLY
+
+    for(unsigned int s = 0; s < 10; s++) {
+        StepGeNN(false);
+        ASSERT_FLOAT_EQ(VQuiet[1], VRef[1]) << "step " << s;
+    }
+    EXPECT_FLOAT_EQ(updatesQuiet[1], IsSkipping() ? 11.0f : 20.0f);
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
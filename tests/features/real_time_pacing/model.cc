@@ -0,0 +1,31 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[1] = {
+    0.0 // 0 - number of updates
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(1.0);
+    model.setName("real_time_pacing");
+
+    neuronModel n;
+    n.varNames = {"updates"};
+    n.varTypes = {"scalar"};
+    n.simCode= "$(updates) += 1.0;\n";
+
+    const int COUNTERNEURON= nModels.size();
+    nModels.push_back(n);
+
+    model.addNeuronPopulation("Pop", 4, COUNTERNEURON, NULL, neuron_ini);
+
+    model.setPrecision(GENN_FLOAT);
+    model.setRealTimePacing(true);
+    model.finalize();
+}
@@ -0,0 +1,31 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(updates) += 1.0;\n");
+
+    SET_VARS({{"updates", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(1.0);
+    model.setName("real_time_pacing_new");
+
+    model.addNeuronPopulation<Neuron>("Pop", 4, {}, Neuron::VarValues(0.0));
+
+    model.setPrecision(GENN_FLOAT);
+    model.setRealTimePacing(true);
+    model.finalize();
+}
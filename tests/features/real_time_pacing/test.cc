@@ -0,0 +1,114 @@
+// Standard includes
+#include <chrono>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+namespace
+{
+std::vector<unsigned long long> overrunSteps;
+
+void recordOverrun(unsigned long long step, double overrunSeconds)
+{
+    EXPECT_GT(overrunSeconds, 0.0);
+    overrunSteps.push_back(step);
+}
+
+//! Wall-clock seconds taken by stepTimeRealTimeCPU(numSteps)
+double timeRealTimeSteps(unsigned int numSteps)
+{
+    const auto start = std::chrono::steady_clock::now();
+    stepTimeRealTimeCPU(numSteps);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        realTimePacer.reset();
+        realTimePacer.setRatio(1.0);
+        realTimePacer.setOverrunCallback(NULL);
+        overrunSteps.clear();
+    }
+};
+
+TEST_P(SimTest, PacesStepsToWallClock)
+{
+    // 50 time steps of 1ms take at least 50ms in real time and 25ms at twice real time
+    EXPECT_GE(timeRealTimeSteps(50), 0.050);
+    realTimePacer.setRatio(2.0);
+    EXPECT_GE(timeRealTimeSteps(50), 0.025);
+
+    // Every step is simulated and recorded
+    EXPECT_EQ(iT, 100ull);
+    EXPECT_FLOAT_EQ(updatesPop[0], 100.0f);
+    EXPECT_EQ(realTimePacer.steps, 100ull);
+    EXPECT_EQ(realTimePacer.latency.count, 100ull);
+    EXPECT_EQ(realTimePacer.jitter.count, 100ull);
+    EXPECT_EQ(std::accumulate(&realTimePacer.latency.histogram[0], &realTimePacer.latency.histogram[GroupTimingStats::numBuckets], 0ULL), 100ull);
+    EXPECT_GE(realTimePacer.maxLatencySeconds, realTimePacer.latency.getMean());
+}
+
+TEST_P(SimTest, OverrunsAreReportedToCallback)
+{
+    // At this ratio no time step can meet its deadline
+    realTimePacer.setRatio(1.0E9);
+    realTimePacer.setOverrunCallback(recordOverrun);
+    stepTimeRealTimeCPU(20);
+
+    EXPECT_EQ(realTimePacer.deadlineMisses, 20ull);
+    EXPECT_GT(realTimePacer.maxOverrunSeconds, 0.0);
+    ASSERT_EQ(overrunSteps.size(), 20u);
+    for(unsigned int i = 0; i < 20; i++) {
+        EXPECT_EQ(overrunSteps[i], i);
+    }
+}
+
+TEST_P(SimTest, DumpsStatistics)
+{
+    stepTimeRealTimeCPU(5);
+
+    // Check JSON dump contains the step count and the latency and jitter statistics
+    dumpRealTimeStats("real_time_pacing.json");
+    FILE *f = fopen("real_time_pacing.json", "r");
+    ASSERT_TRUE(f != NULL);
+    char line[1024];
+    bool foundSteps = false;
+    unsigned int numEntries = 0;
+    while(fgets(line, sizeof(line), f) != NULL) {
+        if(strstr(line, "\"steps\": 5,") != NULL) {
+            foundSteps = true;
+        }
+        if(strstr(line, "\"phase\"") != NULL) {
+            numEntries++;
+        }
+    }
+    fclose(f);
+    remove("real_time_pacing.json");
+    EXPECT_TRUE(foundSteps);
+    EXPECT_EQ(numEntries, 2u);
+}
+
+// Real-time pacing only drives the CPU simulation code
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                ::testing::Values(false));
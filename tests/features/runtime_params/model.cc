@@ -0,0 +1,71 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[1] = {
+    0.0 // 0 - the input
+};
+
+double neuron_p[1] = {
+    0.5 // 0 - constant drive
+};
+
+//! Derived parameter twoA = 2 * a
+class neuron_dp : public dpclass
+{
+public:
+    double calculateDerivedParameter(int index, vector<double> pars, double = 1.0) {
+        switch (index) {
+        case 0:
+            return 2.0 * pars[0];
+        }
+        return -1;
+    }
+};
+
+// Synapses
+//==================================================
+
+double synapses_p[1]= {
+    0.25 // 0 - the weight
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("runtime_params");
+
+    neuronModel n;
+    n.varNames = {"x"};
+    n.varTypes = {"scalar"};
+    n.pNames = {"a"};
+    n.dpNames = {"twoA"};
+    n.dps = new neuron_dp();
+    n.simCode= "$(x) += $(twoA) - $(a) + $(Isyn);\n";
+
+    const int DUMMYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    weightUpdateModel s;
+    s.pNames = {"g"};
+    s.simCode= "$(addtoinSyn) = $(g);\n$(updatelinsyn);\n";
+
+    const int DUMMYSYNAPSE= weightUpdateModels.size();
+    weightUpdateModels.push_back(s);
+
+    model.addNeuronPopulation("Stim", 1, SPIKESOURCE, NULL, NULL);
+    NeuronGroup *pop = model.addNeuronPopulation("Pop", 10, DUMMYNEURON, neuron_p, neuron_ini);
+    pop->setParamRuntimeEnabled("a", true);
+
+    SynapseGroup *syn = model.addSynapsePopulation("Syn", DUMMYSYNAPSE, DENSE, GLOBALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "Pop",
+                                                   NULL, synapses_p,
+                                                   NULL, NULL);
+    syn->setWUParamRuntimeEnabled("g", true);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,59 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 1, 1);
+
+    SET_SIM_CODE("$(x) += $(twoA) - $(a) + $(Isyn);\n");
+
+    SET_PARAM_NAMES({"a"});
+
+    SET_DERIVED_PARAMS({{"twoA", [](const vector<double> &pars, double){ return 2.0 * pars[0]; }}});
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 1, 0);
+
+    SET_PARAM_NAMES({"g"});
+
+    SET_SIM_CODE(
+        "$(addtoinSyn) = $(g);\n"
+        "$(updatelinsyn);\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("runtime_params_new");
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Stim", 1, {}, {});
+    NeuronGroup *pop = model.addNeuronPopulation<Neuron>("Pop", 10, Neuron::ParamValues(0.5), Neuron::VarValues(0.0));
+    pop->setParamRuntimeEnabled("a", true);
+
+    SynapseGroup *syn = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "Stim", "Pop",
+        WeightUpdateModel::ParamValues(0.25), {},
+        {}, {});
+    syn->setWUParamRuntimeEnabled("g", true);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
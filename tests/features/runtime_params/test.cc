@@ -0,0 +1,61 @@
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+    }
+};
+
+TEST_P(SimTest, UsesParametersSetBetweenSteps)
+{
+    // Each step every neuron is driven by its constant parameter and the spike arriving through the synapse group
+    float x = 0.0f;
+    for(unsigned int i = 0; i < 30; i++)
+    {
+        // Change the neuron and weight update parameters without regenerating the model,
+        // updating the derived parameter which depends on the neuron parameter alongside it
+        if(i == 10) {
+            setaPop(1.0f);
+            settwoAPop(2.0f);
+        }
+        else if(i == 20) {
+            setgSyn(0.75f);
+        }
+
+        glbSpkCntStim[0] = 1;
+        glbSpkStim[0] = 0;
+
+        StepGeNN();
+
+        x += ((i < 10) ? 0.5f : 1.0f) + ((i < 20) ? 0.25f : 0.75f);
+        for(unsigned int n = 0; n < 10; n++) {
+            ASSERT_FLOAT_EQ(xPop[n], x);
+        }
+    }
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
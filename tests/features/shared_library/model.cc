@@ -0,0 +1,52 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[1] = {
+    0.0 // 0 - x
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[1]= {
+    1.0 // 0 - the weight
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+    GENN_PREFERENCES::buildSharedLibrary = true;
+
+    model.setDT(0.1);
+    model.setName("shared_library");
+
+    neuronModel n;
+    n.varNames = {"x"};
+    n.varTypes = {"scalar"};
+    n.simCode= "$(x) += DT + $(Isyn);\n";
+
+    const int DUMMYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    weightUpdateModel s;
+    s.varNames = {"g"};
+    s.varTypes = {"scalar"};
+    s.simCode= "$(addtoinSyn) = $(g);\n$(updatelinsyn);\n";
+
+    const int DUMMYSYNAPSE= weightUpdateModels.size();
+    weightUpdateModels.push_back(s);
+
+    model.addNeuronPopulation("Stim", 1, SPIKESOURCE, NULL, NULL);
+    model.addNeuronPopulation("Pop", 10, DUMMYNEURON, NULL, neuron_ini);
+
+    model.addSynapsePopulation("Syn", DUMMYSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "Pop",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,129 @@
+// Standard C++ includes
+#include <fstream>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// GeNN includes
+#include "sharedLibraryModel.h"
+
+#define STRINGIFY(X) #X
+#define TO_STRING(X) STRINGIFY(X)
+
+//----------------------------------------------------------------------------
+// SharedLibraryTest
+//----------------------------------------------------------------------------
+class SharedLibraryTest : public ::testing::Test
+{
+protected:
+    //--------------------------------------------------------------------------
+    // test virtuals
+    //--------------------------------------------------------------------------
+    virtual void SetUp()
+    {
+        // Loading a copy of the library gives the process a second, independent instance of the model
+        {
+            std::ifstream src(SHARED_LIBRARY_PATH, std::ios::binary);
+            std::ofstream dst(SIM_CODE_PATH "/copy.so", std::ios::binary);
+            dst << src.rdbuf();
+        }
+
+        ASSERT_TRUE(m_First.open(SHARED_LIBRARY_PATH)) << m_First.getError();
+        ASSERT_TRUE(m_Second.open(SIM_CODE_PATH "/copy.so")) << m_Second.getError();
+
+        for(auto *m : {&m_First, &m_Second}) {
+            m->allocateMem();
+            m->initialize();
+            m->initModel();
+        }
+    }
+
+    virtual void TearDown()
+    {
+        for(auto *m : {&m_First, &m_Second}) {
+            if(m->isOpen()) {
+                m->freeMem();
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Helpers
+    //--------------------------------------------------------------------------
+    static void stimulate(SharedLibraryModel &model)
+    {
+        model.getVar<unsigned int>("glbSpkCntStim")[0] = 1;
+        model.getVar<unsigned int>("glbSpkStim")[0] = 0;
+    }
+
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    SharedLibraryModel m_First;
+    SharedLibraryModel m_Second;
+};
+
+TEST_F(SharedLibraryTest, ExportsModel)
+{
+    EXPECT_STREQ(m_First.getModelName(), TO_STRING(MODEL_NAME));
+    EXPECT_FALSE(m_First.isGPUAvailable());
+
+    EXPECT_NE(m_First.getVar<float>("xPop"), nullptr);
+    EXPECT_NE(m_First.getVar<float>("gSyn"), nullptr);
+    EXPECT_NE(m_First.getVar<float>("inSynSyn"), nullptr);
+    EXPECT_EQ(m_First.getVar<float>("yPop"), nullptr);
+
+    const VarDescriptor *x = m_First.getVarDescriptor("x", "Pop");
+    ASSERT_NE(x, nullptr);
+    EXPECT_EQ(x->getCount(), 10u);
+    EXPECT_EQ(x->getHostPointer(), m_First.getVar<float>("xPop"));
+    EXPECT_NE(x->getHostPointer(), m_Second.getVarDescriptor("x", "Pop")->getHostPointer());
+    EXPECT_EQ(m_First.getNumVarDescriptors(), numVarDescriptors);
+
+    SharedLibraryModel missing;
+    EXPECT_FALSE(missing.open(SIM_CODE_PATH "/missing.so"));
+    EXPECT_FALSE(missing.getError().empty());
+}
+
+TEST_F(SharedLibraryTest, SimulatesInstancesIndependently)
+{
+    // Drive second instance with a different weight
+    float *gSecond = m_Second.getVar<float>("gSyn");
+    for(unsigned int i = 0; i < 10; i++) {
+        gSecond[i] = 2.0f;
+    }
+
+    for(unsigned int i = 0; i < 10; i++) {
+        stimulate(m_First);
+        m_First.stepTimeCPU();
+    }
+    for(unsigned int i = 0; i < 5; i++) {
+        stimulate(m_Second);
+        m_Second.stepTimeCPU();
+    }
+
+    EXPECT_EQ(m_First.getTimestep(), 10ULL);
+    EXPECT_EQ(m_Second.getTimestep(), 5ULL);
+    EXPECT_FLOAT_EQ(m_Second.getTime(), 0.5f);
+
+    // Neither instance shares state with the copy of the model linked into this executable
+    EXPECT_EQ(iT, 0ULL);
+
+    const float *xFirst = m_First.getVar<float>("xPop");
+    const float *xSecond = m_Second.getVar<float>("xPop");
+    for(unsigned int i = 0; i < 10; i++) {
+        EXPECT_FLOAT_EQ(xFirst[i], 10.0f * (0.1f + 1.0f));
+        EXPECT_FLOAT_EQ(xSecond[i], 5.0f * (0.1f + 2.0f));
+    }
+
+    // Reinitialising and resetting time restarts the simulation
+    m_First.initialize();
+    m_First.setTimestep(0);
+    stimulate(m_First);
+    m_First.stepTimeCPU();
+    EXPECT_EQ(m_First.getTimestep(), 1ULL);
+    EXPECT_FLOAT_EQ(xFirst[0], 0.1f + 1.0f);
+}
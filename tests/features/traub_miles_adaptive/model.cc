@@ -0,0 +1,84 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double stdTM_p[8]= {
+    7.15,       // 0 - gNa: Na conductance in 1/(mOhms * cm^2)
+    50.0,       // 1 - ENa: Na equi potential in mV
+    1.43,       // 2 - gK: K conductance in 1/(mOhms * cm^2)
+    -95.0,      // 3 - EK: K equi potential in mV
+    0.02672,    // 4 - gl: leak conductance in 1/(mOhms * cm^2)
+    -63.563,    // 5 - El: leak equi potential in mV
+    0.143,      // 6 - Cmem: membr. capacity density in muF/cm^2
+    1000.0      // 7 - ntimes: number of Euler substeps
+};
+
+double stdTM_ini[4]= {
+    -60.0,      // 0 - membrane potential E
+    0.0529324,  // 1 - prob. for Na channel activation m
+    0.3176767,  // 2 - prob. for not Na channel blocking h
+    0.5961207   // 3 - prob. for K channel activation n
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[1]= {
+    0.0 // 0 - the weight
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("traub_miles_adaptive");
+
+    weightUpdateModel s;
+    s.varNames = {"g"};
+    s.varTypes = {"scalar"};
+    s.simCode= "$(addtoinSyn) = $(g);\n$(updatelinsyn);\n";
+
+    const int DUMMYSYNAPSE= weightUpdateModels.size();
+    weightUpdateModels.push_back(s);
+
+    // **NOTE** there are no legacy versions of the adaptive models
+    NeuronModels::TraubMilesAdaptive::ParamValues adaptiveParams(
+        7.15,       // 0 - gNa: Na conductance in 1/(mOhms * cm^2)
+        50.0,       // 1 - ENa: Na equi potential in mV
+        1.43,       // 2 - gK: K conductance in 1/(mOhms * cm^2)
+        -95.0,      // 3 - EK: K equi potential in mV
+        0.02672,    // 4 - gl: leak conductance in 1/(mOhms * cm^2)
+        -63.563,    // 5 - El: leak equi potential in mV
+        0.143,      // 6 - Cmem: membr. capacity density in muF/cm^2
+        0.01,       // 7 - errTol: tolerated local error in mV
+        100.0);     // 8 - maxSubsteps: maximum number of substeps
+    NeuronModels::TraubMilesAdaptive::VarValues adaptiveInit(
+        -60.0,      // 0 - membrane potential E
+        0.0529324,  // 1 - prob. for Na channel activation m
+        0.3176767,  // 2 - prob. for not Na channel blocking h
+        0.5961207,  // 3 - prob. for K channel activation n
+        0.0);       // 4 - substep: start with one substep
+
+    model.addNeuronPopulation("Stim", 1, SPIKESOURCE, NULL, NULL);
+    model.addNeuronPopulation("Ref", 4, TRAUBMILES_PSTEP, stdTM_p, stdTM_ini);
+    model.addNeuronPopulation<NeuronModels::TraubMilesAdaptive>("Heun", 4, adaptiveParams, adaptiveInit);
+    model.addNeuronPopulation<NeuronModels::TraubMilesAdaptiveRK3>("RK3", 4, adaptiveParams, adaptiveInit);
+
+    // Stim drives each neuron of each population with a different current
+    model.addSynapsePopulation("StimRef", DUMMYSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "Ref",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+    model.addSynapsePopulation("StimHeun", DUMMYSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "Heun",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+    model.addSynapsePopulation("StimRK3", DUMMYSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "RK3",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+
+    model.setPrecision(GENN_DOUBLE);
+    model.finalize();
+}
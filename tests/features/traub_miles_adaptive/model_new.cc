@@ -0,0 +1,81 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SIM_CODE(
+        "$(addtoinSyn) = $(g);\n"
+        "$(updatelinsyn);\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("traub_miles_adaptive_new");
+
+    NeuronModels::TraubMilesNStep::ParamValues refParams(
+        7.15,       // 0 - gNa: Na conductance in 1/(mOhms * cm^2)
+        50.0,       // 1 - ENa: Na equi potential in mV
+        1.43,       // 2 - gK: K conductance in 1/(mOhms * cm^2)
+        -95.0,      // 3 - EK: K equi potential in mV
+        0.02672,    // 4 - gl: leak conductance in 1/(mOhms * cm^2)
+        -63.563,    // 5 - El: leak equi potential in mV
+        0.143,      // 6 - Cmem: membr. capacity density in muF/cm^2
+        1000.0);    // 7 - ntimes: number of Euler substeps
+    NeuronModels::TraubMilesNStep::VarValues refInit(
+        -60.0,      // 0 - membrane potential E
+        0.0529324,  // 1 - prob. for Na channel activation m
+        0.3176767,  // 2 - prob. for not Na channel blocking h
+        0.5961207); // 3 - prob. for K channel activation n
+
+    NeuronModels::TraubMilesAdaptive::ParamValues adaptiveParams(
+        7.15,       // 0 - gNa: Na conductance in 1/(mOhms * cm^2)
+        50.0,       // 1 - ENa: Na equi potential in mV
+        1.43,       // 2 - gK: K conductance in 1/(mOhms * cm^2)
+        -95.0,      // 3 - EK: K equi potential in mV
+        0.02672,    // 4 - gl: leak conductance in 1/(mOhms * cm^2)
+        -63.563,    // 5 - El: leak equi potential in mV
+        0.143,      // 6 - Cmem: membr. capacity density in muF/cm^2
+        0.01,       // 7 - errTol: tolerated local error in mV
+        100.0);     // 8 - maxSubsteps: maximum number of substeps
+    NeuronModels::TraubMilesAdaptive::VarValues adaptiveInit(
+        -60.0,      // 0 - membrane potential E
+        0.0529324,  // 1 - prob. for Na channel activation m
+        0.3176767,  // 2 - prob. for not Na channel blocking h
+        0.5961207,  // 3 - prob. for K channel activation n
+        0.0);       // 4 - substep: start with one substep
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Stim", 1, {}, {});
+    model.addNeuronPopulation<NeuronModels::TraubMilesNStep>("Ref", 4, refParams, refInit);
+    model.addNeuronPopulation<NeuronModels::TraubMilesAdaptive>("Heun", 4, adaptiveParams, adaptiveInit);
+    model.addNeuronPopulation<NeuronModels::TraubMilesAdaptiveRK3>("RK3", 4, adaptiveParams, adaptiveInit);
+
+    // Stim drives each neuron of each population with a different current
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "StimRef", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Ref",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {});
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "StimHeun", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Heun",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {});
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "StimRK3", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "RK3",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {});
+
+    model.setPrecision(GENN_DOUBLE);
+    model.finalize();
+}
@@ -0,0 +1,144 @@
+// Standard C++ includes
+#include <algorithm>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Every simulation starts from the first time step
+        iT = 0;
+        t = 0.0;
+
+        // Drive neurons of each population with currents from below to well above the rheobase
+        const double current[4] = {0.05, 0.2, 0.4, 0.8};
+        for(unsigned int i = 0; i < 4; i++) {
+            gStimRef[i] = current[i];
+            gStimHeun[i] = current[i];
+            gStimRK3[i] = current[i];
+        }
+    }
+
+protected:
+    //----------------------------------------------------------------------------
+    // Protected methods
+    //----------------------------------------------------------------------------
+    // Simulate numSteps steps with or without input, adding the steps neurons spike on to spikeSteps
+    void Simulate(unsigned int numSteps, bool input)
+    {
+        for(unsigned int s = 0; s < numSteps; s++) {
+            glbSpkCntStim[0] = input ? 1 : 0;
+            glbSpkStim[0] = 0;
+#ifndef CPU_ONLY
+            if(GetParam()) {
+                pushStimSpikesToDevice();
+            }
+#endif  // CPU_ONLY
+
+            StepGeNN();
+
+#ifndef CPU_ONLY
+            if(GetParam()) {
+                copySpikesFromDevice();
+            }
+#endif  // CPU_ONLY
+            const unsigned int step = (unsigned int)iT - 1;
+            addSpikes(step, glbSpkCntRef[0], glbSpkRef, m_RefSpikeSteps);
+            addSpikes(step, glbSpkCntHeun[0], glbSpkHeun, m_HeunSpikeSteps);
+            addSpikes(step, glbSpkCntRK3[0], glbSpkRK3, m_RK3SpikeSteps);
+
+            if(input) {
+                for(unsigned int i = 0; i < 4; i++) {
+                    m_MinHeunSubstep = std::min(m_MinHeunSubstep, substepHeun[i]);
+                    m_MinRK3Substep = std::min(m_MinRK3Substep, substepRK3[i]);
+                }
+            }
+        }
+    }
+
+    std::vector<unsigned int> m_RefSpikeSteps[4];
+    std::vector<unsigned int> m_HeunSpikeSteps[4];
+    std::vector<unsigned int> m_RK3SpikeSteps[4];
+    double m_MinHeunSubstep = DT;
+    double m_MinRK3Substep = DT;
+
+private:
+    static void addSpikes(unsigned int step, unsigned int spikeCount, const unsigned int *spikes, std::vector<unsigned int> (&spikeSteps)[4])
+    {
+        for(unsigned int i = 0; i < spikeCount; i++) {
+            spikeSteps[spikes[i]].push_back(step);
+        }
+    }
+};
+
+TEST_P(SimTest, OneSubstepAtRest)
+{
+    Simulate(100, false);
+
+    for(unsigned int i = 0; i < 4; i++) {
+        ASSERT_DOUBLE_EQ(substepHeun[i], DT);
+        ASSERT_DOUBLE_EQ(substepRK3[i], DT);
+        ASSERT_NEAR(VHeun[i], VRef[i], 0.01);
+        ASSERT_NEAR(VRK3[i], VRef[i], 0.01);
+    }
+}
+
+TEST_P(SimTest, SpikesMatchReference)
+{
+    Simulate(100, false);
+    Simulate(500, true);
+    Simulate(200, false);
+
+    // The weakest input is below the rheobase and the others make neurons fire repeatedly
+    EXPECT_TRUE(m_RefSpikeSteps[0].empty());
+    for(unsigned int i = 1; i < 4; i++) {
+        EXPECT_GE(m_RefSpikeSteps[i].size(), 3u);
+    }
+
+    // Spikes occur within a time step of the reference spikes
+    for(unsigned int i = 0; i < 4; i++) {
+        ASSERT_EQ(m_HeunSpikeSteps[i].size(), m_RefSpikeSteps[i].size()) << "neuron " << i;
+        ASSERT_EQ(m_RK3SpikeSteps[i].size(), m_RefSpikeSteps[i].size()) << "neuron " << i;
+        for(size_t s = 0; s < m_RefSpikeSteps[i].size(); s++) {
+            ASSERT_NEAR(m_HeunSpikeSteps[i][s], m_RefSpikeSteps[i][s], 1) << "neuron " << i << " spike " << s;
+            ASSERT_NEAR(m_RK3SpikeSteps[i][s], m_RefSpikeSteps[i][s], 1) << "neuron " << i << " spike " << s;
+        }
+    }
+
+    // Substeps shrink during spikes and grow back once neurons return to rest
+    EXPECT_LT(m_MinHeunSubstep, DT / 5.0);
+    EXPECT_LT(m_MinRK3Substep, DT / 5.0);
+    for(unsigned int i = 0; i < 4; i++) {
+        ASSERT_DOUBLE_EQ(substepHeun[i], DT);
+        ASSERT_DOUBLE_EQ(substepRK3[i], DT);
+        ASSERT_NEAR(VHeun[i], VRef[i], 0.1);
+        ASSERT_NEAR(VRK3[i], VRef[i], 0.1);
+    }
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
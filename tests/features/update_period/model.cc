@@ -0,0 +1,82 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[3] = {
+    0.0, // 0 - membrane potential
+    0.0, // 1 - elapsed time
+    0.0  // 2 - integrated input
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[1]= {
+    0.0 // 0 - the weight
+};
+
+double dynamics_ini[1]= {
+    0.0 // 0 - elapsed time
+};
+
+double postExp_p[2]= {
+    1.0, // 0 - tau_S: decay time constant for S [ms]
+    1.0  // 1 - Erev: Reversal potential
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("update_period");
+
+    neuronModel n;
+    n.varNames = {"V", "x", "y"};
+    n.varTypes = {"scalar", "scalar", "scalar"};
+    n.simCode= "$(x) += DT;\n$(y) += $(Isyn);\n";
+    n.thresholdConditionCode = "$(x) >= 1000.0";
+
+    const int DUMMYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    weightUpdateModel s;
+    s.varNames = {"g"};
+    s.varTypes = {"scalar"};
+    s.simCode= "$(addtoinSyn) = $(g);\n$(updatelinsyn);\n";
+
+    const int DUMMYSYNAPSE= weightUpdateModels.size();
+    weightUpdateModels.push_back(s);
+
+    weightUpdateModel d;
+    d.varNames = {"w"};
+    d.varTypes = {"scalar"};
+    d.synapseDynamics = "$(w) += DT;\n";
+
+    const int DYNAMICSSYNAPSE= weightUpdateModels.size();
+    weightUpdateModels.push_back(d);
+
+    model.addNeuronPopulation("Stim", 1, SPIKESOURCE, NULL, NULL);
+    model.addNeuronPopulation("Fast", 1, DUMMYNEURON, NULL, neuron_ini);
+    NeuronGroup *slow = model.addNeuronPopulation("Slow", 1, DUMMYNEURON, NULL, neuron_ini);
+
+    model.addSynapsePopulation("StimFast", DUMMYSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, EXPDECAY, "Stim", "Fast",
+                               synapses_ini, NULL,
+                               NULL, postExp_p);
+    model.addSynapsePopulation("StimSlow", DUMMYSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, EXPDECAY, "Stim", "Slow",
+                               synapses_ini, NULL,
+                               NULL, postExp_p);
+    SynapseGroup *dyn = model.addSynapsePopulation("Dyn", DYNAMICSSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Stim", "Fast",
+                                                   dynamics_ini, NULL,
+                                                   NULL, NULL);
+
+    // Slow is only updated every fourth time step and the dynamics of Dyn every third
+    slow->setUpdatePeriod(4);
+    dyn->setUpdatePeriod(3);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
@@ -0,0 +1,89 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 3);
+
+    SET_SIM_CODE(
+        "$(x) += DT;\n"
+        "$(y) += $(Isyn);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("$(x) >= 1000.0");
+
+    SET_VARS({{"V", "scalar"}, {"x", "scalar"}, {"y", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SIM_CODE(
+        "$(addtoinSyn) = $(g);\n"
+        "$(updatelinsyn);\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+//----------------------------------------------------------------------------
+// DynamicsModel
+//----------------------------------------------------------------------------
+class DynamicsModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(DynamicsModel, 0, 1);
+
+    SET_VARS({{"w", "scalar"}});
+
+    SET_SYNAPSE_DYNAMICS_CODE("$(w) += DT;\n");
+};
+
+IMPLEMENT_MODEL(DynamicsModel);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+
+    model.setDT(0.1);
+    model.setName("update_period_new");
+
+    PostsynapticModels::ExpCond::ParamValues expCondParams(
+        1.0,    // 0 - tau_S: decay time constant for S [ms]
+        1.0);   // 1 - Erev: Reversal potential
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Stim", 1, {}, {});
+    model.addNeuronPopulation<Neuron>("Fast", 1, {}, Neuron::VarValues(0.0, 0.0, 0.0));
+    NeuronGroup *slow = model.addNeuronPopulation<Neuron>("Slow", 1, {}, Neuron::VarValues(0.0, 0.0, 0.0));
+
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::ExpCond>(
+        "StimFast", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Fast",
+        {}, WeightUpdateModel::VarValues(0.0),
+        expCondParams, {});
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::ExpCond>(
+        "StimSlow", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Slow",
+        {}, WeightUpdateModel::VarValues(0.0),
+        expCondParams, {});
+    SynapseGroup *dyn = model.addSynapsePopulation<DynamicsModel, PostsynapticModels::DeltaCurr>(
+        "Dyn", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Stim", "Fast",
+        {}, DynamicsModel::VarValues(0.0),
+        {}, {});
+
+    // Slow is only updated every fourth time step and the dynamics of Dyn every third
+    slow->setUpdatePeriod(4);
+    dyn->setUpdatePeriod(3);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
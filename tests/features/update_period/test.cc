@@ -0,0 +1,109 @@
+// Standard C++ includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Update periods are counted from the first time step
+        iT = 0;
+        t = 0.0;
+
+        gStimFast[0] = 0.5f;
+        gStimSlow[0] = 0.5f;
+    }
+
+protected:
+    //----------------------------------------------------------------------------
+    // Protected methods
+    //----------------------------------------------------------------------------
+    void StepGeNN(bool stimSpike)
+    {
+        glbSpkCntStim[0] = stimSpike ? 1 : 0;
+        glbSpkStim[0] = 0;
+#ifndef CPU_ONLY
+        if(GetParam()) {
+            pushStimSpikesToDevice();
+        }
+#endif  // CPU_ONLY
+        SimulationTest::StepGeNN();
+    }
+};
+
+TEST_P(SimTest, SlowGroupIntegratesOverPeriod)
+{
+    for(unsigned int s = 0; s < 12; s++) {
+        StepGeNN(false);
+
+        // Slow is updated on steps 0, 4 and 8 and advances by four time steps each time
+        ASSERT_FLOAT_EQ(xFast[0], (float)(s + 1) * DT);
+        ASSERT_FLOAT_EQ(xSlow[0], (float)(((s / 4) + 1) * 4) * DT) << "step " << s;
+    }
+}
+
+TEST_P(SimTest, SlowGroupDecaysOverPeriod)
+{
+    // Stimulate both groups on the first time step only
+    for(unsigned int s = 0; s < 12; s++) {
+        StepGeNN(s == 0);
+    }
+
+    // Fast receives input decayed over every time step and Slow over every fourth
+    const double e1 = std::exp(-DT / 1.0);
+    const double e4 = std::exp(-4.0 * DT / 1.0);
+    double expectedYFast = 0.0;
+    for(unsigned int s = 0; s < 12; s++) {
+        expectedYFast += 0.5 * std::pow(e1, s);
+    }
+    EXPECT_NEAR(yFast[0], expectedYFast, 1e-5);
+    EXPECT_NEAR(ySlow[0], 0.5 * (1.0 + e4 + (e4 * e4)), 1e-5);
+}
+
+TEST_P(SimTest, InputAccumulatesBetweenUpdates)
+{
+    // Stimulate on steps 1 and 2, between the updates of Slow on steps 0 and 4
+    for(unsigned int s = 0; s < 4; s++) {
+        StepGeNN(s == 1 || s == 2);
+        ASSERT_FLOAT_EQ(ySlow[0], 0.0f);
+    }
+
+    StepGeNN(false);
+    EXPECT_FLOAT_EQ(ySlow[0], 1.0f);
+}
+
+TEST_P(SimTest, SynapseDynamicsUpdatePeriod)
+{
+    for(unsigned int s = 0; s < 10; s++) {
+        StepGeNN(false);
+    }
+
+    // Dynamics of Dyn run on steps 0, 3, 6 and 9 and advance by three time steps each time
+    EXPECT_FLOAT_EQ(wDyn[0], 12.0f * DT);
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
@@ -0,0 +1,55 @@
+#include "modelSpec.h"
+
+// NEURONS
+//==============
+
+double neuron_ini[2] = {
+    0.0, // 0 - the time
+    0.0  // 1 - individual shift
+};
+
+
+// Synapses
+//==================================================
+
+double synapses_ini[1]= {
+    0.0 // 0 - the weight
+};
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+    model.setDT(0.1);
+    model.setName("var_descriptors");
+
+    neuronModel n;
+    n.varNames = {"x", "shift"};
+    n.varTypes = {"scalar", "scalar"};
+    n.simCode= "$(x)= $(t)+$(shift);\n";
+
+    const int DUMMYNEURON= nModels.size();
+    nModels.push_back(n);
+
+    weightUpdateModel s;
+    s.varNames = {"w"};
+    s.varTypes = {"scalar"};
+    s.simCode= "$(addtoinSyn) = $(w);\n$(updatelinsyn);\n";
+    s.simLearnPost= "$(w)= $(x_pre);\n";
+
+    const int DUMMYSYNAPSE= weightUpdateModels.size();
+    weightUpdateModels.push_back(s);
+
+    model.addNeuronPopulation("Pre", 10, DUMMYNEURON, NULL, neuron_ini);
+    model.addNeuronPopulation("Post", 5, DUMMYNEURON, NULL, neuron_ini);
+
+    model.addSynapsePopulation("Dense", DUMMYSYNAPSE, DENSE, INDIVIDUALG, NO_DELAY, IZHIKEVICH_PS, "Pre", "Post",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+    model.addSynapsePopulation("Sparse", DUMMYSYNAPSE, SPARSE, INDIVIDUALG, 2, IZHIKEVICH_PS, "Pre", "Post",
+                               synapses_ini, NULL,
+                               NULL, NULL);
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
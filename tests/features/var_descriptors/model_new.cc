@@ -0,0 +1,57 @@
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 2);
+
+    SET_SIM_CODE("$(x)= $(t)+$(shift);\n");
+
+    SET_VARS({{"x", "scalar"}, {"shift", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"w", "scalar"}});
+
+    SET_SIM_CODE(
+        "$(addtoinSyn) = $(w);\n"
+        "$(updatelinsyn);\n");
+    SET_LEARN_POST_CODE("$(w)= $(x_pre);\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+
+void modelDefinition(NNmodel &model)
+{
+    initGeNN();
+    model.setDT(0.1);
+    model.setName("var_descriptors_new");
+
+    model.addNeuronPopulation<Neuron>("Pre", 10, {}, Neuron::VarValues(0.0, 0.0));
+    model.addNeuronPopulation<Neuron>("Post", 5, {}, Neuron::VarValues(0.0, 0.0));
+
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Dense", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {});
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Sparse", SynapseMatrixType::SPARSE_INDIVIDUALG, 2, "Pre", "Post",
+        {}, WeightUpdateModel::VarValues(0.0),
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+    model.finalize();
+}
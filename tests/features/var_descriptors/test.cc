@@ -0,0 +1,98 @@
+// Standard C++ includes
+#include <set>
+#include <string>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include DEFINITIONS_HEADER
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        allocateSparse(20);
+    }
+
+    //----------------------------------------------------------------------------
+    // Protected methods
+    //----------------------------------------------------------------------------
+    const VarDescriptor *getChecked(const char *name, const char *group, size_t count, void *hostPtr)
+    {
+        const VarDescriptor *var = getVarDescriptor(name, group);
+        EXPECT_NE(var, nullptr) << name << group;
+        if(var != NULL) {
+            EXPECT_EQ(var->getCount(), count) << name << group;
+            EXPECT_EQ(var->getHostPointer(), hostPtr) << name << group;
+        }
+        return var;
+    }
+};
+
+TEST_P(SimTest, DescribesAllArrays)
+{
+    // Every array is listed once
+    std::set<std::string> names;
+    for(unsigned int i = 0; i < numVarDescriptors; i++) {
+        EXPECT_TRUE(names.insert(std::string(varDescriptorTable[i].name) + "/" + varDescriptorTable[i].group).second);
+        EXPECT_NE(varDescriptorTable[i].getHostPointer(), nullptr);
+    }
+
+    // Neuron variables - x is read with a delay so it and the spikes of Pre are stored for 3 delay slots
+    const VarDescriptor *x = getChecked("x", "Pre", 30, xPre);
+    EXPECT_STREQ(x->type, "float");
+    EXPECT_EQ(x->elementSize, sizeof(float));
+    getChecked("shift", "Pre", 10, shiftPre);
+    getChecked("glbSpkCnt", "Pre", 3, glbSpkCntPre);
+    getChecked("glbSpk", "Pre", 30, glbSpkPre);
+    getChecked("x", "Post", 5, xPost);
+    getChecked("glbSpkCnt", "Post", 1, glbSpkCntPost);
+
+    // Dense synapse variables
+    getChecked("inSyn", "Dense", 5, inSynDense);
+    getChecked("w", "Dense", 50, wDense);
+
+    // Sparse synapse variables and connectivity are sized by the number of connections
+    getChecked("w", "Sparse", 20, wSparse);
+    const VarDescriptor *ind = getChecked("ind", "Sparse", 20, CSparse.ind);
+    EXPECT_STREQ(ind->type, "unsigned int");
+    getChecked("indInG", "Sparse", 11, CSparse.indInG);
+    getChecked("revIndInG", "Sparse", 6, CSparse.revIndInG);
+    getChecked("revInd", "Sparse", 20, CSparse.revInd);
+    getChecked("remap", "Sparse", 20, CSparse.remap);
+    EXPECT_EQ(ind->getSizeBytes(), 20 * sizeof(unsigned int));
+
+#ifndef CPU_ONLY
+    EXPECT_EQ(x->getDevicePointer(), d_xPre);
+    EXPECT_EQ(ind->getDevicePointer(), d_indSparse);
+#else
+    EXPECT_EQ(x->getDevicePointer(), nullptr);
+#endif
+
+    // Unknown variables and groups
+    EXPECT_EQ(getVarDescriptor("y", "Pre"), nullptr);
+    EXPECT_EQ(getVarDescriptor("x", "Dense"), nullptr);
+    EXPECT_EQ(getVarDescriptor("preInd", "Sparse"), nullptr);
+}
+
+#ifndef CPU_ONLY
+auto simulatorBackends = ::testing::Values(true, false);
+#else
+auto simulatorBackends = ::testing::Values(false);
+#endif
+
+WRAPPED_INSTANTIATE_TEST_CASE_P(MODEL_NAME,
+                                SimTest,
+                                simulatorBackends);
@@ -54,6 +54,30 @@ TEST_P(SingleValueSubstitutionTest, CorrectGeneratedValue)
     ASSERT_DOUBLE_EQ(result, GetParam());
 }
 
+TEST(SubstituteTest, ReplacementContainingTarget)
+{
+    // Replacement text is not searched again so this must terminate
+    std::string code = "$(x) + $(x)";
+    substitute(code, "$(x)", "$(x)$(x)");
+    ASSERT_EQ(code, "$(x)$(x) + $(x)$(x)");
+}
+
+TEST(CodeSubstitutionsTest, SinglePass)
+{
+    CodeSubstitutions substitutions;
+    substitutions.addNameSubstitutions("l", {"V", "U"});
+    substitutions.addValueSubstitutions({"a"}, {1.0});
+
+    // First binding for a name takes precedence, as with successive calls to substitute
+    substitutions.addVarSubstitution("V", "ignored");
+
+    std::string code = "$(V) += $(a) * $(U) - $(V_pre) + $(a b);";
+    std::vector<std::string> unresolved;
+    substitutions.apply(code, &unresolved);
+    ASSERT_EQ(code, "lV += (1.00000000000000000e+00) * lU - $(V_pre) + $(a b);");
+    ASSERT_EQ(unresolved, std::vector<std::string>{"V_pre"});
+}
+
 //--------------------------------------------------------------------------
 // Instatiations
 //--------------------------------------------------------------------------
@@ -282,6 +282,9 @@ name= toString("inputfiles/gIzh_sparse_ind_ee");
   }
   
   timer.stopTimer();
+#ifdef EVENT_COUNTING
+  fprintf(stdout, "# benchmark: %llu steps in %f seconds, %llu synapse updates\n", iT, timer.getElapsedTime(), getTotalSynapseUpdates());
+#endif // EVENT_COUNTING
   
   cout << "Output files are created under the current directory. Output and parameters are logged in: " << logname << endl;
   fprintf(timef, "%d %d %u %u %.4f %.2f %.1f %.2f %u %s %s\n",which, PCNN.model.getNumNeurons(), PCNN.sumPExc, PCNN.sumPInh, timer.getElapsedTime(),VPExc[0], TOTAL_TME, DT, sumSynapses, logname.c_str(), PCNN.model.getPrecision().c_str());
@@ -121,5 +121,8 @@ void modelDefinition(NNmodel &model)
     model.setGPUDevice(nGPU);
   #endif 
   model.setPrecision(_FTYPE);
+#ifdef EVENT_COUNTING
+  model.setEventCounting(true);
+#endif // EVENT_COUNTING
   model.finalize();
 }
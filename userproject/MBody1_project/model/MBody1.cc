@@ -185,5 +185,8 @@ void modelDefinition(NNmodel &model)
 #else
     model.setTiming(false);
 #endif // TIMING
+#ifdef EVENT_COUNTING
+    model.setEventCounting(true);
+#endif // EVENT_COUNTING
   model.finalize();
 }
@@ -210,6 +210,9 @@ int main(int argc, char *argv[])
   if (which == GPU) pullDNStateFromDevice();
 #endif
   cerr << "output files are created under the current directory." << endl;
+#ifdef EVENT_COUNTING
+  fprintf(stdout, "# benchmark: %llu steps in %f seconds, %llu synapse updates\n", iT, timer.getElapsedTime(), getTotalSynapseUpdates());
+#endif // EVENT_COUNTING
   fprintf(timef, "%d %u %u %u %u %u %.4f %.2f %.1f %.2f\n",which, locust.model.getNumNeurons(), locust.sumPN, locust.sumKC, locust.sumLHI, locust.sumDN, timer.getElapsedTime(),VDN[0], TOTAL_TME, DT);
   fprintf(stdout, "GPU=%d, %u neurons, %u PN spikes, %u KC spikes, %u LHI spikes, %u DN spikes, simulation took %.4f secs, VDN[0]=%.2f DT=%.1f %.2f\n",which, locust.model.getNumNeurons(), locust.sumPN, locust.sumKC, locust.sumLHI, locust.sumDN, timer.getElapsedTime(),VDN[0], TOTAL_TME, DT);
 
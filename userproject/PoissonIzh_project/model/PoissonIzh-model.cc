@@ -190,10 +190,11 @@ void classol::run(float runtime, unsigned int which)
 
 void classol::output_state(FILE *f, unsigned int which)
 {
-  if (which == GPU) 
+  if (which == GPU) {
 #ifndef CPU_ONLY
     copyStateFromDevice();
 #endif
+  }
   auto *pn = model.findNeuronGroup("PN");
   fprintf(f, "%f ", t);
   for (int i= 0; i < pn->getNumNeurons(); i++) {
@@ -70,5 +70,8 @@ void modelDefinition(NNmodel &model)
   //model.setSynapseG("PNIzh1", gPNIzh1);
   model.setSeed(1234);
   model.setPrecision(_FTYPE);
+#ifdef EVENT_COUNTING
+  model.setEventCounting(true);
+#endif // EVENT_COUNTING
   model.finalize();
 }
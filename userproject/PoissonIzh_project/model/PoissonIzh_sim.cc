@@ -163,6 +163,9 @@ int main(int argc, char *argv[])
   cerr << "Output files are created under the current directory." << endl;
   float elapsedTime= timer.getElapsedTime();
   fprintf(timef, "%d %d %f \n", PNIzhNN.sumPN, PNIzhNN.sumIzh1, elapsedTime);
+#ifdef EVENT_COUNTING
+  fprintf(stdout, "# benchmark: %llu steps in %f seconds, %llu synapse updates\n", iT, elapsedTime, getTotalSynapseUpdates());
+#endif // EVENT_COUNTING
   fprintf(stdout, "%d Poisson spikes evoked spikes on %d Izhikevich neurons in %f seconds.\n", PNIzhNN.sumPN, PNIzhNN.sumIzh1, elapsedTime);
 
   return 0;
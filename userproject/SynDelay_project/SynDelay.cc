@@ -46,6 +46,9 @@ void modelDefinition(NNmodel &model)
     model.setName("SynDelay");
     model.setDT(1.0);
     model.setPrecision(GENN_FLOAT);
+#ifdef EVENT_COUNTING
+    model.setEventCounting(true);
+#endif // EVENT_COUNTING
     
     // INPUT NEURONS
     //==============
@@ -121,6 +121,9 @@ int main(int argc, char *argv[])
     }
     timer->stopTimer();
     cout << "# done in " << timer->getElapsedTime() << " seconds" << endl;
+#ifdef EVENT_COUNTING
+    cout << "# benchmark: " << iT << " steps in " << timer->getElapsedTime() << " seconds, " << getTotalSynapseUpdates() << " synapse updates" << endl;
+#endif // EVENT_COUNTING
     fileTime << timer->getElapsedTime() << endl;
     fileTime.close();
     fileV.close();
@@ -0,0 +1,133 @@
+#!/bin/bash
+#Scaling benchmark for the CPU_ONLY code path, built from the example projects.
+#call this as:
+#$ bash benchmarkprojects.sh [output csv] [scales]
+#e.g.
+#$ bash benchmarkprojects.sh benchmark.csv "1 2 4 8"
+#then compare against an earlier run with:
+#$ bash comparebenchmarks.sh baseline.csv benchmark.csv
+#
+#For every project and scale factor the model is set up with its generate_run tool
+#(input patterns, sizes.h), after which code generation, compilation and the
+#simulation itself are timed separately. Models are built with -DEVENT_COUNTING so
+#that the simulators report the number of simulated time steps and synapse updates
+#(see NNmodel::setEventCounting). One CSV row is written per project and scale:
+#project,scale,steps,steps_per_s,syn_events_per_s,gen_s,compile_s,init_s,sim_s,peak_rss_kb
+#
+set -e #exit if error or segfault
+
+csvFile=${1:-$GENN_PATH/userproject/benchmark_`date +'%d%m%y_%H%M'`.csv}
+scales=${2:-"1 2 4"}
+
+#Output directory
+testDir=benchmark
+
+#All models are built with event counting enabled; the project makefiles and
+#genn-buildmodel.sh both append to CXXFLAGS from the environment
+export CXXFLAGS="$CXXFLAGS -DEVENT_COUNTING"
+
+# current time in seconds
+now () {
+    date +%s.%N
+}
+
+# elapsed time in seconds since $1
+since () { # $1=start time
+    echo "$(now) $1" | awk '{printf "%.3f", $1 - $2}'
+}
+
+# run command, logging output to $logFile and recording wall-clock time in runTime and peak resident set size in peakRSS
+run_measured () {
+    local start=$(now)
+    if [ -x /usr/bin/time ]; then
+        /usr/bin/time -f "%M" -o rss.tmp "$@" > $logFile 2>&1
+        peakRSS=$(tail -n 1 rss.tmp)
+        rm -f rss.tmp
+    else
+        #no GNU time - poll high water mark of the process instead
+        "$@" > $logFile 2>&1 &
+        local pid=$!
+        peakRSS=0
+        while kill -0 $pid 2> /dev/null; do
+            local hwm=$(awk '/VmHWM/ {print $2}' /proc/$pid/status 2> /dev/null)
+            if [ -n "$hwm" ] && [ "$hwm" -gt "$peakRSS" ]; then
+                peakRSS=$hwm
+            fi
+            sleep 0.02
+        done
+        wait $pid
+    fi
+    runTime=$(since $start)
+}
+
+# time generation, compilation and simulation of a model whose sizes.h has already been written
+# and append the result to the CSV file
+benchmark () { # $1=project, $2=scale, $3=model directory, $4=model name, $5...=simulator command
+    local project=$1
+    local scale=$2
+    local modelDir=$3
+    local modelName=$4
+    shift 4
+    logFile=$GENN_PATH/userproject/${project}_${scale}_${testDir}.log
+
+    pushd $modelDir > /dev/null
+    local start=$(now)
+    genn-buildmodel.sh -c $modelName.cc > $logFile 2>&1
+    local genTime=$(since $start)
+
+    start=$(now)
+    make clean all SIM_CODE=${modelName}_CODE CPU_ONLY=1 >> $logFile 2>&1
+    local compileTime=$(since $start)
+    popd > /dev/null
+
+    run_measured "$@"
+    local result=$(grep "# benchmark:" $logFile | tail -n 1)
+    if [ -z "$result" ]; then
+        echo "ERROR: no benchmark summary in" $logFile
+        exit 1
+    fi
+
+    #"# benchmark: <steps> steps in <seconds> seconds, <updates> synapse updates"
+    echo "$project $scale $genTime $compileTime $runTime $peakRSS $result" | awk '{
+        steps= $9; simTime= $12; updates= $14;
+        initTime= $5 - simTime; if (initTime < 0) initTime= 0;
+        stepRate= (simTime > 0) ? steps / simTime : 0;
+        eventRate= (simTime > 0) ? updates / simTime : 0;
+        printf "%s,%s,%d,%.1f,%.1f,%.3f,%.3f,%.3f,%.3f,%d\n", $1, $2, steps, stepRate, eventRate, $3, $4, initTime, simTime, $6
+    }' | tee -a $csvFile
+}
+
+echo "Making tools..."
+cd $GENN_PATH/userproject/tools
+make clean > /dev/null && make > /dev/null
+cd ..
+
+echo "project,scale,steps,steps_per_s,syn_events_per_s,gen_s,compile_s,init_s,sim_s,peak_rss_kb" > $csvFile
+
+for scale in $scales; do
+    printf "\n\n####################### Izh_sparse x${scale} ######################\n"
+    cd $GENN_PATH/userproject/Izh_sparse_project
+    make clean > /dev/null && make > /dev/null
+    ./generate_run 0 $((1000*scale)) 100 1 ${testDir} Izh_sparse 1.0 CPU_ONLY=1 > /dev/null 2>&1
+    benchmark Izh_sparse $scale model Izh_sparse model/Izh_sim_sparse ${testDir} 0
+
+    printf "\n\n####################### MBody1 x${scale} ######################\n"
+    cd $GENN_PATH/userproject/MBody1_project
+    make clean > /dev/null && make > /dev/null
+    ./generate_run 0 100 $((1000*scale)) 20 100 0.0025 ${testDir} MBody1 CPU_ONLY=1 > /dev/null 2>&1
+    benchmark MBody1 $scale model MBody1 model/classol_sim ${testDir} 0
+
+    printf "\n\n####################### PoissonIzh x${scale} ######################\n"
+    cd $GENN_PATH/userproject/PoissonIzh_project
+    make clean > /dev/null && make > /dev/null
+    ./generate_run 0 $((100*scale)) $((10*scale)) 0.5 2 ${testDir} PoissonIzh CPU_ONLY=1 > /dev/null 2>&1
+    benchmark PoissonIzh $scale model PoissonIzh model/PoissonIzh_sim ${testDir} 0
+done
+
+#SynDelay has fixed population sizes so is only run once
+printf "\n\n####################### SynDelay ######################\n"
+cd $GENN_PATH/userproject/SynDelay_project
+benchmark SynDelay 1 . SynDelay ./syn_delay 0 ${testDir}
+
+cd $GENN_PATH/userproject
+echo "Benchmark complete! Results written to" $csvFile
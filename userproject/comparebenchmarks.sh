@@ -0,0 +1,52 @@
+#!/bin/bash
+#Compare two CSV files written by benchmarkprojects.sh and flag regressions.
+#call this as:
+#$ bash comparebenchmarks.sh baseline.csv current.csv [tolerance in percent, default 10]
+#
+#Rows are matched on project and scale. Throughputs (steps_per_s, syn_events_per_s)
+#regress when they drop, times and peak memory regress when they grow, by more than
+#the tolerance. The script exits with status 1 if any regression was found.
+#
+if [ $# -lt 2 ]; then
+    echo "usage: comparebenchmarks.sh <baseline csv> <current csv> [tolerance %]"
+    exit 2
+fi
+
+baseline=$1
+current=$2
+tolerance=${3:-10}
+
+awk -F, -v tol=$tolerance '
+FNR == 1 {
+    # header - remember column names
+    for (i = 1; i <= NF; i++) col[i]= $i;
+    next;
+}
+NR == FNR {
+    for (i = 3; i <= NF; i++) base[$1 "," $2, i]= $i;
+    seen[$1 "," $2]= 1;
+    next;
+}
+{
+    key= $1 "," $2;
+    if (!(key in seen)) {
+        printf "%-24s not in baseline\n", key;
+        next;
+    }
+    for (i = 4; i <= NF; i++) {
+        b= base[key, i];
+        if (b <= 0) continue;
+        change= 100.0 * ($i - b) / b;
+
+        # throughputs should not drop, everything else should not grow
+        higherIsBetter= (col[i] == "steps_per_s" || col[i] == "syn_events_per_s");
+        worse= higherIsBetter ? -change : change;
+        flag= (worse > tol) ? "REGRESSION" : "";
+        if (flag != "") regressions++;
+        printf "%-24s %-18s %14s %14s %+8.1f%% %s\n", key, col[i], b, $i, change, flag;
+    }
+}
+END {
+    printf "\n%d regression(s) beyond %s%% tolerance\n", regressions, tol;
+    exit (regressions > 0) ? 1 : 0;
+}' $baseline $current
@@ -89,8 +89,8 @@ all: $(EXECUTABLE)
 $(EXECUTABLE): $(OBJECTS)
 	$(CXX) $(CXXFLAGS) -o $@ $(OBJECTS) $(LINK_FLAGS)
 
-$(SIM_CODE)/runner.o:
-	cd $(SIM_CODE) && make
+$(SIM_CODE)/runner.o: $(wildcard $(SIM_CODE)/*.cc $(SIM_CODE)/*.h $(SIM_CODE)/Makefile)
+	$(MAKE) -C $(SIM_CODE)
 
 %.o: %.c
 	$(CXX) $(CXXFLAGS) -c -o $@ $< $(INCLUDE_FLAGS)
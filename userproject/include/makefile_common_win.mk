@@ -60,7 +60,7 @@ LINK_FLAGS              =$(LINK_FLAGS) "$(GENN_PATH)\lib\lib\genn_CPU_ONLY.lib"
 !IFNDEF SIM_CODE
 !ERROR You must define SIM_CODE=<model>_CODE in the Makefile or NMAKE command.
 !ENDIF
-OBJECTS                 =$(SOURCES:.cc=.obj) $(SIM_CODE)\runner.obj
+OBJECTS                 =$(SOURCES:.cc=.obj) $(SIM_CODE)\runner.lib
 OBJECTS                 =$(OBJECTS:.cpp=.obj)
 OBJECTS                 =$(OBJECTS:.cu=.obj)
 OBJECTS                 =$(OBJECTS:.c=.obj)
@@ -74,7 +74,7 @@ all: $(EXECUTABLE)
 $(EXECUTABLE): $(OBJECTS)
 	$(CXX) $(CXXFLAGS) /Fe$@ $(OBJECTS) $(LINK_FLAGS)
 
-$(SIM_CODE)\runner.obj:
+$(SIM_CODE)\runner.lib:
 	cd $(SIM_CODE) && nmake /nologo
 
 .c.obj: